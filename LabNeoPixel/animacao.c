@@ -0,0 +1,256 @@
+#include "LabNeoPixel/animacao.h"
+#include "LabNeoPixel/matriz.h"
+#include "LabNeoPixel/neopixel_driver.h"
+#include "pico/stdlib.h"
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct {
+    anim_efeito_t efeito;
+    bool ativa;
+    uint16_t passo;
+    uint32_t proximo_ms;        // Quando desenhar o próximo passo
+    matriz_t quadro;            // Último passo desenhado
+    matriz_t anterior;          // Saída da camada quando a transição começou
+    uint32_t trans_inicio_ms;
+    uint16_t trans_ms;          // 0 = sem transição em andamento
+} camada_t;
+
+static camada_t camadas[ANIM_CAMADAS];
+static uint32_t ultimo_quadro_ms;
+static bool composicao_pendente;
+static matriz_t saida;
+
+// Ordem do preenchimento em espiral (canto superior esquerdo → centro),
+// montada uma vez para o tamanho configurado da matriz
+static uint8_t ordem_espiral[LED_COUNT][2];
+static bool espiral_pronta = false;
+
+static void gerar_espiral(void) {
+    int x0 = 0, y0 = 0, x1 = NUM_COLUNAS - 1, y1 = NUM_LINHAS - 1;
+    uint k = 0;
+
+#define ANOTAR(px, py) do { ordem_espiral[k][0] = (px); ordem_espiral[k][1] = (py); k++; } while (0)
+    while (x0 <= x1 && y0 <= y1) {
+        for (int x = x0; x <= x1; ++x) ANOTAR(x, y0);
+        for (int y = y0 + 1; y <= y1; ++y) ANOTAR(x1, y);
+        if (y1 > y0) for (int x = x1 - 1; x >= x0; --x) ANOTAR(x, y1);
+        if (x1 > x0) for (int y = y1 - 1; y > y0; --y) ANOTAR(x0, y);
+        x0++; y0++; x1--; y1--;
+    }
+#undef ANOTAR
+
+    espiral_pronta = true;
+}
+
+static uint16_t total_passos(anim_tipo_t tipo) {
+    switch (tipo) {
+        case ANIM_SOLIDO:            return 1;
+        case ANIM_PISCA:             return 2;
+        case ANIM_ESPIRAL:
+        case ANIM_ESPIRAL_INVERSA:   return LED_COUNT;
+        case ANIM_ONDA_VERTICAL:     return NUM_LINHAS + 3;
+        case ANIM_ONDA_BRILHO:
+        case ANIM_FILEIRAS:
+        case ANIM_FILEIRAS_REVERSO:  return NUM_LINHAS;
+        case ANIM_COLUNAS:
+        case ANIM_COLUNAS_REVERSO:   return NUM_COLUNAS;
+        default:                     return 1;
+    }
+}
+
+// Desenha o passo 'n' do efeito em 'q' (quadro inteiro, sem estado entre passos)
+static void desenhar_passo(const anim_efeito_t *ef, uint16_t n, matriz_t *q) {
+    const uint r = ef->r, g = ef->g, b = ef->b;
+
+    matriz_limpar(q);
+
+    switch (ef->tipo) {
+        case ANIM_SOLIDO:
+            matriz_preencher(q, r, g, b);
+            break;
+
+        case ANIM_PISCA:
+            if (n == 0) matriz_preencher(q, r, g, b);
+            break;
+
+        case ANIM_ESPIRAL:
+        case ANIM_ESPIRAL_INVERSA:
+            // A inversa percorre a mesma ordem de trás para frente
+            if (!espiral_pronta) gerar_espiral();
+            for (uint i = 0; i <= n; ++i) {
+                uint k = (ef->tipo == ANIM_ESPIRAL) ? i : LED_COUNT - 1 - i;
+                matriz_pixel(q, ordem_espiral[k][0], ordem_espiral[k][1], r, g, b);
+            }
+            break;
+
+        case ANIM_ONDA_VERTICAL:
+            for (int y = 0; y < NUM_LINHAS; ++y) {
+                // Intensidade em quartos: 4/4 na linha da fase, -1/4 por linha de distância
+                int intensidade = 4 - abs((int)n - y);
+                if (intensidade <= 0) continue;
+                matriz_fileira(q, y, (r * intensidade) >> 2, (g * intensidade) >> 2, (b * intensidade) >> 2);
+            }
+            break;
+
+        case ANIM_ONDA_BRILHO:
+            for (uint y = 0; y <= n; ++y) {
+                uint brilho = y + 1;
+                matriz_fileira(q, y, r * brilho / NUM_LINHAS, g * brilho / NUM_LINHAS, b * brilho / NUM_LINHAS);
+            }
+            break;
+
+        case ANIM_FILEIRAS:
+        case ANIM_FILEIRAS_REVERSO: {
+            uint y = (ef->tipo == ANIM_FILEIRAS) ? n : NUM_LINHAS - 1 - n;
+            uint brilho = (ef->tipo == ANIM_FILEIRAS) ? y + 1 : NUM_LINHAS - y;
+            matriz_fileira(q, y, r * brilho / NUM_LINHAS, g * brilho / NUM_LINHAS, b * brilho / NUM_LINHAS);
+            break;
+        }
+
+        case ANIM_COLUNAS:
+        case ANIM_COLUNAS_REVERSO: {
+            uint x = (ef->tipo == ANIM_COLUNAS) ? n : NUM_COLUNAS - 1 - n;
+            uint brilho = (ef->tipo == ANIM_COLUNAS) ? x + 1 : NUM_COLUNAS - x;
+            matriz_coluna(q, x, r * brilho / NUM_COLUNAS, g * brilho / NUM_COLUNAS, b * brilho / NUM_COLUNAS);
+            break;
+        }
+
+        default:
+            break;
+    }
+}
+
+// Saída de uma camada, já misturada com o quadro anterior durante a transição
+static inline npLED_t saida_camada(const camada_t *c, uint i, uint alfa) {
+    npLED_t p = c->quadro.px[i];
+    if (alfa < 256) {
+        const npLED_t a = c->anterior.px[i];
+        p.R = (uint8_t)((a.R * (256 - alfa) + p.R * alfa) >> 8);
+        p.G = (uint8_t)((a.G * (256 - alfa) + p.G * alfa) >> 8);
+        p.B = (uint8_t)((a.B * (256 - alfa) + p.B * alfa) >> 8);
+    }
+    return p;
+}
+
+static uint alfa_transicao(camada_t *c, uint32_t agora_ms) {
+    if (c->trans_ms == 0) return 256;
+
+    uint32_t decorrido = agora_ms - c->trans_inicio_ms;
+    if (decorrido >= c->trans_ms) {
+        c->trans_ms = 0;
+        return 256;
+    }
+    return (decorrido * 256u) / c->trans_ms;
+}
+
+// Junta as camadas em 'saida': pixel apagado deixa ver a camada de baixo
+static void compor(uint32_t agora_ms) {
+    uint alfa[ANIM_CAMADAS];
+    for (int k = 0; k < ANIM_CAMADAS; ++k) {
+        alfa[k] = alfa_transicao(&camadas[k], agora_ms);
+    }
+
+    for (uint i = 0; i < LED_COUNT; ++i) {
+        npLED_t p = {0, 0, 0};
+        for (int k = 0; k < ANIM_CAMADAS; ++k) {
+            npLED_t c = saida_camada(&camadas[k], i, alfa[k]);
+            if (c.R | c.G | c.B) p = c;
+        }
+        saida.px[i] = p;
+    }
+}
+
+static bool mesmo_efeito(const anim_efeito_t *a, const anim_efeito_t *b) {
+    return a->tipo == b->tipo && a->r == b->r && a->g == b->g && a->b == b->b &&
+           a->periodo_ms == b->periodo_ms && a->repetir == b->repetir;
+}
+
+/**
+ * @brief Troca o efeito de uma camada.
+ *
+ * Pedir o efeito que a camada já mostra não o reinicia. Com transicao_ms > 0
+ * o quadro atual da camada se mistura ao novo efeito nesse intervalo.
+ */
+void anim_iniciar(int camada, const anim_efeito_t *ef, uint16_t transicao_ms) {
+    if (camada < 0 || camada >= ANIM_CAMADAS) return;
+    camada_t *c = &camadas[camada];
+
+    if (c->efeito.tipo != ANIM_NENHUM && mesmo_efeito(&c->efeito, ef)) return;
+
+    uint32_t agora_ms = to_ms_since_boot(get_absolute_time());
+    uint alfa = alfa_transicao(c, agora_ms);
+    for (uint i = 0; i < LED_COUNT; ++i) {
+        c->anterior.px[i] = saida_camada(c, i, alfa);
+    }
+
+    c->efeito = *ef;
+    c->ativa = true;
+    c->passo = 0;
+    c->proximo_ms = agora_ms;
+    c->trans_inicio_ms = agora_ms;
+    c->trans_ms = transicao_ms;
+}
+
+// Apaga a camada na hora (sem transição)
+void anim_parar(int camada) {
+    if (camada < 0 || camada >= ANIM_CAMADAS) return;
+    camada_t *c = &camadas[camada];
+
+    if (c->efeito.tipo == ANIM_NENHUM) return;
+
+    memset(c, 0, sizeof(*c));
+    composicao_pendente = true;
+}
+
+bool anim_ativa(int camada) {
+    return camada >= 0 && camada < ANIM_CAMADAS && camadas[camada].ativa;
+}
+
+/**
+ * @brief Avança as camadas e envia um novo quadro quando algo mudou.
+ *
+ * Chamado com frequência (tempo ocioso do executor). Cada chamada custa no
+ * máximo um passo por camada e uma composição de LED_COUNT pixels; quadros
+ * saem no máximo a cada ANIM_QUADRO_MIN_MS.
+ *
+ * @return true se um quadro foi entregue ao driver.
+ */
+bool efeito_tick(uint32_t agora_ms) {
+    if (agora_ms - ultimo_quadro_ms < ANIM_QUADRO_MIN_MS) return false;
+
+    bool mudou = composicao_pendente;
+    for (int k = 0; k < ANIM_CAMADAS; ++k) {
+        camada_t *c = &camadas[k];
+        if (c->trans_ms) mudou = true;
+        if (!c->ativa || (int32_t)(agora_ms - c->proximo_ms) < 0) continue;
+
+        desenhar_passo(&c->efeito, c->passo, &c->quadro);
+        mudou = true;
+
+        c->proximo_ms = agora_ms + c->efeito.periodo_ms;
+        if (++c->passo >= total_passos(c->efeito.tipo)) {
+            c->passo = 0;
+            if (!c->efeito.repetir) c->ativa = false;   // Mantém o último quadro
+        }
+    }
+
+    if (!mudou) return false;
+
+    compor(agora_ms);
+    matriz_enviar(&saida);
+    ultimo_quadro_ms = agora_ms;
+    composicao_pendente = false;
+    return true;
+}
+
+void anim_executar_bloqueante(const anim_efeito_t *ef) {
+    matriz_t quadro;
+    uint16_t n = total_passos(ef->tipo);
+    for (uint16_t passo = 0; passo < n; ++passo) {
+        desenhar_passo(ef, passo, &quadro);
+        memcpy(leds, quadro.px, sizeof(quadro.px));
+        npWrite();
+        sleep_ms(ef->periodo_ms);
+    }
+}
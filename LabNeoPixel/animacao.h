@@ -0,0 +1,46 @@
+#ifndef ANIMACAO_H
+#define ANIMACAO_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "LabNeoPixel/neopixel_driver.h"
+
+// Camadas do compositor, desenhadas em ordem (a de cima cobre a de baixo
+// onde tiver pixel aceso; pixel apagado é transparente)
+#define ANIM_CAMADA_BASE     0   // Cor por tendência (Tarefa 4)
+#define ANIM_CAMADA_ALERTA   1   // Alerta piscante (Tarefa 5)
+#define ANIM_CAMADAS         2
+
+// Intervalo mínimo entre quadros enviados (≈50 quadros/s no máximo)
+#define ANIM_QUADRO_MIN_MS   20
+
+typedef enum {
+    ANIM_NENHUM = 0,
+    ANIM_SOLIDO,                // Matriz toda na cor
+    ANIM_PISCA,                 // Cor / apagado, um passo cada
+    ANIM_ESPIRAL,
+    ANIM_ESPIRAL_INVERSA,
+    ANIM_ONDA_VERTICAL,
+    ANIM_ONDA_BRILHO,
+    ANIM_FILEIRAS,
+    ANIM_FILEIRAS_REVERSO,
+    ANIM_COLUNAS,
+    ANIM_COLUNAS_REVERSO,
+} anim_tipo_t;
+
+typedef struct {
+    anim_tipo_t tipo;
+    uint8_t r, g, b;
+    uint16_t periodo_ms;        // Tempo de cada passo
+    bool repetir;               // Recomeça ao fim; senão para no último quadro
+} anim_efeito_t;
+
+void anim_iniciar(int camada, const anim_efeito_t *ef, uint16_t transicao_ms);
+void anim_parar(int camada);
+bool anim_ativa(int camada);
+bool efeito_tick(uint32_t agora_ms);
+
+// Modo bloqueante (passo, npWrite, sleep_ms) usado pelos efeitos antigos
+void anim_executar_bloqueante(const anim_efeito_t *ef);
+
+#endif
@@ -0,0 +1,74 @@
+#include "LabNeoPixel/matriz.h"
+#include <string.h>
+
+static inline void pintar(matriz_t *m, uint x, uint y, uint8_t r, uint8_t g, uint8_t b) {
+    npLED_t *p = &m->px[NP_INDICE(x, y)];
+    p->R = r;
+    p->G = g;
+    p->B = b;
+}
+
+void matriz_limpar(matriz_t *m) {
+    memset(m->px, 0, sizeof(m->px));
+}
+
+void matriz_preencher(matriz_t *m, uint8_t r, uint8_t g, uint8_t b) {
+    // Ordem física não importa quando a matriz toda recebe a mesma cor
+    for (uint i = 0; i < LED_COUNT; ++i) {
+        m->px[i].R = r;
+        m->px[i].G = g;
+        m->px[i].B = b;
+    }
+}
+
+void matriz_pixel(matriz_t *m, int x, int y, uint8_t r, uint8_t g, uint8_t b) {
+    if (x < 0 || x >= NUM_COLUNAS || y < 0 || y >= NUM_LINHAS) return;
+    pintar(m, x, y, r, g, b);
+}
+
+void matriz_fileira(matriz_t *m, int y, uint8_t r, uint8_t g, uint8_t b) {
+    matriz_retangulo(m, 0, y, NUM_COLUNAS, 1, r, g, b);
+}
+
+void matriz_coluna(matriz_t *m, int x, uint8_t r, uint8_t g, uint8_t b) {
+    matriz_retangulo(m, x, 0, 1, NUM_LINHAS, r, g, b);
+}
+
+// Retângulo cheio, recortado nas bordas da matriz
+void matriz_retangulo(matriz_t *m, int x, int y, int largura, int altura,
+                      uint8_t r, uint8_t g, uint8_t b) {
+    int x0 = x < 0 ? 0 : x;
+    int y0 = y < 0 ? 0 : y;
+    int x1 = x + largura > NUM_COLUNAS ? NUM_COLUNAS : x + largura;
+    int y1 = y + altura > NUM_LINHAS ? NUM_LINHAS : y + altura;
+
+    for (int yy = y0; yy < y1; ++yy) {
+        for (int xx = x0; xx < x1; ++xx) {
+            pintar(m, xx, yy, r, g, b);
+        }
+    }
+}
+
+// Copia o sprite com o canto superior esquerdo em (x, y); pixels apagados não são copiados
+void matriz_sprite(matriz_t *m, int x, int y, const sprite_t *s) {
+    for (int sy = 0; sy < s->altura; ++sy) {
+        int yy = y + sy;
+        if (yy < 0 || yy >= NUM_LINHAS) continue;
+
+        const npLED_t *linha = &s->px[sy * s->largura];
+        for (int sx = 0; sx < s->largura; ++sx) {
+            int xx = x + sx;
+            if (xx < 0 || xx >= NUM_COLUNAS) continue;
+
+            npLED_t c = linha[sx];
+            if (c.R | c.G | c.B) {
+                m->px[NP_INDICE(xx, yy)] = c;
+            }
+        }
+    }
+}
+
+bool matriz_enviar(const matriz_t *m) {
+    memcpy(leds, m->px, sizeof(m->px));
+    return npWriteAsync();
+}
@@ -0,0 +1,31 @@
+#ifndef MATRIZ_H
+#define MATRIZ_H
+
+#include <stdint.h>
+#include "LabNeoPixel/neopixel_driver.h"
+
+// Quadro da matriz já na ordem física dos LEDs (índice da serpentina).
+// As primitivas só escrevem na memória; o envio é matriz_enviar().
+typedef struct {
+    npLED_t px[LED_COUNT];
+} matriz_t;
+
+// Imagem pequena em linhas (x, y), cor {0,0,0} = transparente
+typedef struct {
+    uint8_t largura, altura;
+    const npLED_t *px;          // largura × altura, linha a linha
+} sprite_t;
+
+void matriz_limpar(matriz_t *m);
+void matriz_preencher(matriz_t *m, uint8_t r, uint8_t g, uint8_t b);
+void matriz_pixel(matriz_t *m, int x, int y, uint8_t r, uint8_t g, uint8_t b);
+void matriz_fileira(matriz_t *m, int y, uint8_t r, uint8_t g, uint8_t b);
+void matriz_coluna(matriz_t *m, int x, uint8_t r, uint8_t g, uint8_t b);
+void matriz_retangulo(matriz_t *m, int x, int y, int largura, int altura,
+                      uint8_t r, uint8_t g, uint8_t b);
+void matriz_sprite(matriz_t *m, int x, int y, const sprite_t *s);
+
+// Copia o quadro para leds[] e entrega ao driver (npWriteAsync)
+bool matriz_enviar(const matriz_t *m);
+
+#endif
@@ -1,38 +1,184 @@
 #include "neopixel_driver.h"
+#include "hardware/dma.h"
+#include "hardware/clocks.h"
+#include "pico/time.h"
 #include "ws2818b.pio.h"
+#include "caminho_rapido.h"
 
 npLED_t leds[LED_COUNT];
 PIO np_pio;
 int sm;
 
+// Quadros já empacotados (G<<24 | R<<16 | B<<8): um vai pelo DMA enquanto o outro é montado
+static uint32_t np_quadros[2][LED_COUNT];
+static int np_dma_canal = -1;
+static int np_enviando = -1;          // Quadro no fio (-1 = nenhum)
+static int np_pendente = -1;          // Quadro pronto esperando o fio liberar
+static absolute_time_t np_fim_quadro; // Fim dos bits + tempo de reset (latch)
+
+// Hash (FNV-1a) do último quadro entregue ao fio; quadro igual não é reenviado
+static uint32_t np_hash_ultimo;
+static bool np_hash_valido = false;
+static uint32_t np_enviados, np_ignorados;
+
+// Correção gama 2.2: np_gama[v] = round(255 * (v / 255)^2.2)
+static const uint8_t np_gama[256] = {
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   2,   2,   2,   2,   2,   2,   2,
+      3,   3,   3,   3,   3,   4,   4,   4,   4,   5,   5,   5,   5,   6,   6,   6,
+      6,   7,   7,   7,   8,   8,   8,   9,   9,   9,  10,  10,  11,  11,  11,  12,
+     12,  13,  13,  13,  14,  14,  15,  15,  16,  16,  17,  17,  18,  18,  19,  19,
+     20,  20,  21,  22,  22,  23,  23,  24,  25,  25,  26,  26,  27,  28,  28,  29,
+     30,  30,  31,  32,  33,  33,  34,  35,  35,  36,  37,  38,  39,  39,  40,  41,
+     42,  43,  43,  44,  45,  46,  47,  48,  49,  49,  50,  51,  52,  53,  54,  55,
+     56,  57,  58,  59,  60,  61,  62,  63,  64,  65,  66,  67,  68,  69,  70,  71,
+     73,  74,  75,  76,  77,  78,  79,  81,  82,  83,  84,  85,  87,  88,  89,  90,
+     91,  93,  94,  95,  97,  98,  99, 100, 102, 103, 105, 106, 107, 109, 110, 111,
+    113, 114, 116, 117, 119, 120, 121, 123, 124, 126, 127, 129, 130, 132, 133, 135,
+    137, 138, 140, 141, 143, 145, 146, 148, 149, 151, 153, 154, 156, 158, 159, 161,
+    163, 165, 166, 168, 170, 172, 173, 175, 177, 179, 181, 182, 184, 186, 188, 190,
+    192, 194, 196, 197, 199, 201, 203, 205, 207, 209, 211, 213, 215, 217, 219, 221,
+    223, 225, 227, 229, 231, 234, 236, 238, 240, 242, 244, 246, 248, 251, 253, 255,
+};
+
+// Gama × brilho global, refeita só quando o brilho muda; usada ao empacotar
+static uint8_t np_lut[256];
+static int np_brilho = -1;
+
 void npInit(uint pin) {
-    uint offset = pio_add_program(pio0, &ws2818b_program);
-    np_pio = pio0;
-    sm = 0; // Usar SM 0 fixamente
-    pio_sm_claim(np_pio, sm);
-    ws2818b_program_init(np_pio, sm, offset, pin, 800000.f);
+    // Programa e SM uma vez só; chamadas seguintes apenas limpam a matriz
+    if (!np_pio) {
+        uint offset = pio_add_program(pio0, &ws2818b_program);
+        np_pio = pio0;
+        sm = 0; // Usar SM 0 fixamente
+        pio_sm_claim(np_pio, sm);
+        ws2818b_program_init(np_pio, sm, offset, pin, NP_FREQ_HZ);
+    }
+
+    if (np_dma_canal < 0) {
+        np_dma_canal = dma_claim_unused_channel(true);
+    }
+    np_fim_quadro = get_absolute_time();
+    np_hash_valido = false;   // Estado dos LEDs desconhecido após o reset
+    npDefinirBrilho(NP_BRILHO_PADRAO);
     npClear();
 }
 
-void npWrite(void) {
+// Refaz o divisor da SM depois de trocar o clk_sys (10 ciclos por bit, como no init).
+// Só com o fio livre: um quadro no meio sairia com bits de duração errada.
+void npAjustarClock(void) {
+    pio_sm_set_clkdiv(np_pio, sm, clock_get_hz(clk_sys) / (10.f * NP_FREQ_HZ));
+}
+
+void npDefinirBrilho(uint8_t brilho) {
+    if (np_brilho == brilho) return;
+
+    np_brilho = brilho;
+    for (uint v = 0; v < 256; ++v) {
+        np_lut[v] = (uint8_t)((np_gama[v] * brilho + 127) / 255);
+    }
+}
+
+uint8_t npBrilho(void) {
+    return (uint8_t)np_brilho;
+}
+
+static inline uint32_t npEmpacotar(uint8_t r, uint8_t g, uint8_t b) {
+    return ((uint32_t)np_lut[g] << 24) | ((uint32_t)np_lut[r] << 16) | ((uint32_t)np_lut[b] << 8);
+}
+
+static void npIniciarDMA(int q) {
+    dma_channel_config c = dma_channel_get_default_config(np_dma_canal);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_dreq(&c, pio_get_dreq(np_pio, sm, true));
+
+    np_enviando = q;
+    np_fim_quadro = make_timeout_time_us(NP_TEMPO_QUADRO_US + NP_RESET_US);
+    dma_channel_configure(np_dma_canal, &c, &np_pio->txf[sm], np_quadros[q], LED_COUNT, true);
+}
+
+// Fio livre: DMA terminou e já passou o tempo dos bits + reset do último quadro
+bool npQuadroConcluido(void) {
+    if (np_enviando >= 0) {
+        if (dma_channel_is_busy(np_dma_canal) ||
+            absolute_time_diff_us(get_absolute_time(), np_fim_quadro) > 0) {
+            return false;
+        }
+        np_enviando = -1;
+    }
+    return np_pendente < 0;
+}
+
+// Dispara o quadro pendente quando o anterior termina (chamar no tempo ocioso)
+void npPoll(void) {
+    if (np_pendente < 0) return;
+
+    (void)npQuadroConcluido();   // Libera o fio se o quadro anterior acabou
+    if (np_enviando >= 0) return;
+
+    int q = np_pendente;
+    np_pendente = -1;
+    npIniciarDMA(q);
+}
+
+static uint32_t CAMINHO_RAPIDO(npHash)(const uint32_t *quadro) {
+    uint32_t h = 2166136261u;
     for (uint i = 0; i < LED_COUNT; ++i) {
-        pio_sm_put_blocking(np_pio, sm, leds[i].G);
-        pio_sm_put_blocking(np_pio, sm, leds[i].R);
-        pio_sm_put_blocking(np_pio, sm, leds[i].B);
+        uint32_t w = quadro[i];
+        for (int k = 0; k < 4; ++k) {
+            h = (h ^ (w & 0xFF)) * 16777619u;
+            w >>= 8;
+        }
     }
+    return h;
 }
 
-void npWriteComBrilho(float brilho) {
+// Empacota leds[] no quadro livre e envia sem esperar. Se o fio ainda está ocupado,
+// o quadro fica pendente (substituindo um pendente mais antigo) e sai no npPoll().
+// Um quadro idêntico ao último entregue é descartado sem tocar no fio.
+bool CAMINHO_RAPIDO(npWriteAsync)(void) {
+    (void)npQuadroConcluido();
+
+    int q = (np_enviando == 0) ? 1 : 0;
     for (uint i = 0; i < LED_COUNT; ++i) {
-        uint8_t r = leds[i].R * brilho;
-        uint8_t g = leds[i].G * brilho;
-        uint8_t b = leds[i].B * brilho;
-        pio_sm_put_blocking(np_pio, sm, g);
-        pio_sm_put_blocking(np_pio, sm, r);
-        pio_sm_put_blocking(np_pio, sm, b);
+        np_quadros[q][i] = npEmpacotar(leds[i].R, leds[i].G, leds[i].B);
+    }
+
+    uint32_t h = npHash(np_quadros[q]);
+    if (np_hash_valido && h == np_hash_ultimo) {
+        np_ignorados++;
+        return false;
+    }
+    np_hash_ultimo = h;
+    np_hash_valido = true;
+    np_enviados++;
+
+    np_pendente = q;
+    npPoll();
+    return np_pendente < 0;
+}
+
+void npEstatisticas(uint32_t *enviados, uint32_t *ignorados) {
+    *enviados = np_enviados;
+    *ignorados = np_ignorados;
+}
+
+void CAMINHO_RAPIDO(npWrite)(void) {
+    npWriteAsync();
+    while (!npQuadroConcluido()) {
+        npPoll();
+        tight_loop_contents();
     }
 }
 
+// Brilho 0–255 passa a valer para os próximos quadros (a tabela é refeita uma vez)
+void npWriteComBrilho(uint8_t brilho) {
+    npDefinirBrilho(brilho);
+    npWrite();
+}
+
 void npSetLED(uint8_t index, uint8_t r, uint8_t g, uint8_t b) {
     if (index < LED_COUNT) {
         leds[index].R = r;
@@ -58,9 +204,31 @@ void liberar_maquina_pio(PIO pio, uint sm_id) {
     }
 }
 
+_Static_assert(NUM_COLUNAS <= NP_MATRIZ_MAX && NUM_LINHAS <= NP_MATRIZ_MAX,
+               "matriz maior que o mapa serpentina");
+
+// Linha física 0 é a de baixo e corre da direita para a esquerda; as linhas alternam o sentido.
+// Fora da matriz o mapa vale 0, como getLEDIndex() sempre devolveu.
+#define NP_LINHA_FISICA(y) (NUM_LINHAS - 1 - (y))
+#define NP_IDX(x, y) \
+    (((x) < NUM_COLUNAS && (y) < NUM_LINHAS) \
+        ? NP_LINHA_FISICA(y) * NUM_COLUNAS + \
+          ((NP_LINHA_FISICA(y) % 2 == 0) ? (NUM_COLUNAS - 1 - (x)) : (x)) \
+        : 0)
+#define NP_LINHA(y) { \
+    NP_IDX(0, y),  NP_IDX(1, y),  NP_IDX(2, y),  NP_IDX(3, y),  \
+    NP_IDX(4, y),  NP_IDX(5, y),  NP_IDX(6, y),  NP_IDX(7, y),  \
+    NP_IDX(8, y),  NP_IDX(9, y),  NP_IDX(10, y), NP_IDX(11, y), \
+    NP_IDX(12, y), NP_IDX(13, y), NP_IDX(14, y), NP_IDX(15, y) }
+
+const uint8_t np_mapa[NP_MATRIZ_MAX][NP_MATRIZ_MAX] = {
+    NP_LINHA(0),  NP_LINHA(1),  NP_LINHA(2),  NP_LINHA(3),
+    NP_LINHA(4),  NP_LINHA(5),  NP_LINHA(6),  NP_LINHA(7),
+    NP_LINHA(8),  NP_LINHA(9),  NP_LINHA(10), NP_LINHA(11),
+    NP_LINHA(12), NP_LINHA(13), NP_LINHA(14), NP_LINHA(15),
+};
+
 uint getLEDIndex(uint x, uint y) {
     if (x >= NUM_COLUNAS || y >= NUM_LINHAS) return 0;
-    uint linha_fisica = NUM_LINHAS - 1 - y;
-    uint base = linha_fisica * NUM_COLUNAS;
-    return (linha_fisica % 2 == 0) ? base + (NUM_COLUNAS - 1 - x) : base + x;
+    return NP_INDICE(x, y);
 }
@@ -1,18 +1,33 @@
 #ifndef NEOPIXEL_DRIVER_H
 #define NEOPIXEL_DRIVER_H
 
+#include <stdbool.h>
 #include <stdint.h>
 #include "hardware/pio.h"
 
-#define LED_COUNT 25
-#define LED_PIN 7
+// Tamanho da matriz (pode ser trocado por -D no build, até NP_MATRIZ_MAX)
+#ifndef NUM_COLUNAS
 #define NUM_COLUNAS 5
+#endif
+#ifndef NUM_LINHAS
 #define NUM_LINHAS 5
+#endif
+#define NP_MATRIZ_MAX 16
+#define LED_COUNT (NUM_COLUNAS * NUM_LINHAS)
+#define LED_PIN 7
 #define COR_APAGA   0
 #define COR_MIN     64
 #define COR_INTER   128
 #define COR_ALTA    192
 
+// 24 bits a 800 kHz por LED, mais o reset (linha baixa) para o quadro ser aceito
+#define NP_TEMPO_QUADRO_US ((LED_COUNT * 24 * 10) / 8)
+#define NP_RESET_US        300
+#define NP_FREQ_HZ         800000.f
+
+// Brilho global (0–255) aplicado junto com a correção gama ao empacotar
+#define NP_BRILHO_PADRAO   255
+
 
 typedef struct {
     uint8_t G, R, B;
@@ -23,12 +38,23 @@ extern PIO np_pio;
 extern int sm;
 
 void npInit(uint pin);
+void npAjustarClock(void);
 void npWrite(void);
-void npWriteComBrilho(float brilho);
+bool npWriteAsync(void);
+bool npQuadroConcluido(void);
+void npPoll(void);
+void npEstatisticas(uint32_t *enviados, uint32_t *ignorados);
+void npWriteComBrilho(uint8_t brilho);
+void npDefinirBrilho(uint8_t brilho);
+uint8_t npBrilho(void);
 void npSetLED(uint8_t index, uint8_t r, uint8_t g, uint8_t b);
 void npSetAll(uint8_t r, uint8_t g, uint8_t b);
 void npClear(void);
 void liberar_maquina_pio(PIO pio, uint sm);
 uint getLEDIndex(uint x, uint y);
 
+// Mapa serpentina (x, y) → índice, resolvido em tempo de compilação
+extern const uint8_t np_mapa[NP_MATRIZ_MAX][NP_MATRIZ_MAX];
+#define NP_INDICE(x, y) (np_mapa[(y)][(x)])
+
 #endif
\ No newline at end of file
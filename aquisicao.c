@@ -0,0 +1,131 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: aquisicao.c
+ *  Projeto: TempCycleDMA
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Liga o motor de aquisição da Tarefa 1 no núcleo certo.
+ *
+ *      No modo dual-core o núcleo 1 registra a IRQ do DMA no
+ *      seu próprio NVIC, inicia o ping-pong e fica fechando
+ *      janelas e publicando-as na fila SPSC. Assim os acessos
+ *      bloqueantes de I2C e PIO do núcleo 0 não atrasam a
+ *      aquisição, e nenhuma variável de resultado é escrita
+ *      por dois contextos ao mesmo tempo.
+ *
+ *  Relacionamento:
+ *      - Chamado por 'setup()' (aquisicao_iniciar) e pela
+ *        Tarefa 1 em 'main.c' (aquisicao_proxima_janela).
+ *      - Reconfigurada pelo console (aquisicao_reconfigurar).
+ *      - Usa 'cfg_temp' e os canais DMA definidos em 'setup.h'.
+ *
+ *  
+ *  Data: 14/10/2026
+ * ------------------------------------------------------------
+ */
+
+#include "pico/stdlib.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "aquisicao.h"
+#include "irq_handlers.h"
+#include "setup.h"
+#include "supervisor.h"
+
+#if TEMPCYCLE_DUAL_CORE
+#include "pico/multicore.h"
+#include "hardware/sync.h"
+#include "pico/flash.h"
+#include "fila_janelas.h"
+
+#define NUCLEO1_INTERVALO_MS 5   // Granularidade do fechamento de janelas
+#define NUCLEO1_PRAZO_MS 1000    // Cobre a pausa do flash_safe_execute do núcleo 0
+
+static uint8_t fonte_nucleo1 = SUPERVISOR_NENHUMA;
+
+// Caixa de uma configuração: escrita pelo núcleo 0, aplicada pelo núcleo 1
+static config_aquisicao_t cfg_nova;
+static volatile bool cfg_pendente = false;
+#endif
+
+static bool iniciada = false;
+
+/**
+ * @brief Registra a IRQ dos canais do ping-pong no núcleo que chama.
+ *
+ * A habilitação no NVIC vale apenas para o núcleo corrente, por isso
+ * esta função roda no núcleo que será dono da aquisição.
+ */
+static void configurar_irq_dma(void) {
+    dma_channel_set_irq0_enabled(DMA_TEMP_CHANNEL, true);
+    dma_channel_set_irq0_enabled(DMA_TEMP_CHANNEL_B, true);
+    irq_set_exclusive_handler(DMA_IRQ_0, dma_handler_temp);
+    // Acima das IRQs do cyw43/lwIP (build com Wi-Fi): o rádio não atrasa a troca de buffer
+    irq_set_priority(DMA_IRQ_0, PICO_HIGHEST_IRQ_PRIORITY);
+    irq_set_enabled(DMA_IRQ_0, true);
+}
+
+#if TEMPCYCLE_DUAL_CORE
+/**
+ * @brief Laço do núcleo 1: fecha janelas e as publica na fila.
+ */
+static void nucleo1_principal(void) {
+    flash_safe_execute_core_init();   // Aceita pausar enquanto o núcleo 0 grava o histórico
+    configurar_irq_dma();
+    tarefa1_iniciar(&cfg_temp, DMA_TEMP_CHANNEL, DMA_TEMP_CHANNEL_B);
+
+    resultado_aquisicao_t janela;
+    while (true) {
+        if (cfg_pendente) {
+            __dmb();
+            tarefa1_configurar(&cfg_nova);
+            __dmb();
+            cfg_pendente = false;
+        }
+        if (tarefa1_janela_concluida(&janela)) {
+            fila_janelas_publicar(&janela);
+        }
+        supervisor_batida(fonte_nucleo1);
+        sleep_ms(NUCLEO1_INTERVALO_MS);
+    }
+}
+#endif
+
+void aquisicao_iniciar(void) {
+    if (iniciada) return;
+    iniciada = true;
+
+    // Canais fixos do ping-pong ficam reservados antes de qualquer
+    // dma_claim_unused_channel() (ex.: envio do OLED por DMA)
+    dma_channel_claim(DMA_TEMP_CHANNEL);
+    dma_channel_claim(DMA_TEMP_CHANNEL_B);
+
+#if TEMPCYCLE_DUAL_CORE
+    fonte_nucleo1 = supervisor_registrar("nucleo1", NUCLEO1_PRAZO_MS);
+    multicore_launch_core1(nucleo1_principal);
+#else
+    configurar_irq_dma();
+    tarefa1_iniciar(&cfg_temp, DMA_TEMP_CHANNEL, DMA_TEMP_CHANNEL_B);
+#endif
+}
+
+bool aquisicao_proxima_janela(resultado_aquisicao_t *j) {
+#if TEMPCYCLE_DUAL_CORE
+    return fila_janelas_consumir(j);
+#else
+    return tarefa1_janela_concluida(j);
+#endif
+}
+
+void aquisicao_reconfigurar(const config_aquisicao_t *cfg) {
+#if TEMPCYCLE_DUAL_CORE
+    if (iniciada) {
+        while (cfg_pendente) tight_loop_contents();
+        cfg_nova = *cfg;
+        __dmb();
+        cfg_pendente = true;
+        return;
+    }
+#endif
+    tarefa1_configurar(cfg);
+}
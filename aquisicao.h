@@ -0,0 +1,54 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: aquisicao.h
+ *  Projeto: TempCycleDMA
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Ponto único de partida da aquisição e de entrega das
+ *      janelas às demais tarefas, independente do núcleo em
+ *      que o pipeline ADC/DMA roda.
+ *
+ *      - Modo padrão: IRQ do DMA e fechamento das janelas no
+ *        núcleo 0, dentro da Tarefa 1.
+ *      - TEMPCYCLE_DUAL_CORE=1: o núcleo 1 é dono do ADC, do
+ *        DMA, da IRQ e da redução; as janelas chegam ao núcleo
+ *        0 pela fila SPSC de 'fila_janelas.c'.
+ *
+ *  
+ *  Data: 14/10/2026
+ * ------------------------------------------------------------
+ */
+
+#ifndef AQUISICAO_H
+#define AQUISICAO_H
+
+#include <stdbool.h>
+#include "tarefa1_temp.h"
+
+#ifndef TEMPCYCLE_DUAL_CORE
+#define TEMPCYCLE_DUAL_CORE 0
+#endif
+
+/**
+ * @brief Liga a aquisição (uma única vez; chamadas extras são ignoradas).
+ */
+void aquisicao_iniciar(void);
+
+/**
+ * @brief Entrega a próxima janela fechada ao núcleo 0.
+ *
+ * @param j Destino da janela
+ * @return true se havia uma janela nova
+ */
+bool aquisicao_proxima_janela(resultado_aquisicao_t *j);
+
+/**
+ * @brief Troca a configuração da aquisição em andamento.
+ *
+ * Com TEMPCYCLE_DUAL_CORE a troca é entregue ao núcleo 1, que a aplica
+ * entre duas janelas (espera a troca anterior, no máximo um intervalo
+ * do laço dele).
+ */
+void aquisicao_reconfigurar(const config_aquisicao_t *cfg);
+
+#endif  // AQUISICAO_H
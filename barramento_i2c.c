@@ -0,0 +1,240 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: barramento_i2c.c
+ *  Projeto: TempCycleDMA
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Motor de transações do i2c compartilhado.
+ *
+ *      Uma transação por vez no barramento: o DMA TX empurra
+ *      as palavras para o IC_DATA_CMD (16 bits, com STOP e
+ *      RESTART por palavra) e, se houver leitura, o DMA RX
+ *      tira os bytes do FIFO RX. A IRQ do i2c (STOP_DET ou
+ *      TX_ABRT) encerra a transação e dispara a próxima: a
+ *      fila alta primeiro, em ordem de chegada dentro de cada
+ *      prioridade. O callback roda fora do spin lock.
+ *
+ *      barramento_i2c_poll() faz a mesma conferência sem IRQ
+ *      (build de host e estados que a IRQ não cobre, como o
+ *      DMA RX terminando depois do STOP_DET).
+ *
+ *  Relacionamento:
+ *      - Quadros do OLED em 'inc/ssd1306_i2c.c'
+ *      - Iniciado em 'setup.c' depois de i2c_init
+ *      - Relatório no console ('console.c')
+ *
+ *
+ *  Data: 14/10/2026
+ * ------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/sync.h"
+#include "barramento_i2c.h"
+#include "caminho_rapido.h"
+#include "memoria.h"
+
+static i2c_inst_t *barramento = NULL;
+static int canal_tx = -1, canal_rx = -1;
+static spin_lock_t *trava = NULL;
+
+static transacao_i2c_t *fila_ini[I2C_PRIORIDADES], *fila_fim[I2C_PRIORIDADES];
+static transacao_i2c_t *atual = NULL;     // No barramento
+static uint32_t atual_inicio_us;
+
+static estatisticas_i2c_t est;
+
+// Põe 't' no barramento (chamado com a trava)
+static void CAMINHO_RAPIDO(iniciar_transacao)(transacao_i2c_t *t) {
+    i2c_hw_t *hw = i2c_get_hw(barramento);
+    uint8_t p = t->prioridade;
+
+    atual = t;
+    atual_inicio_us = time_us_32();
+    uint32_t espera = atual_inicio_us - t->submetida_us;
+    if (espera > est.espera_max_us[p]) est.espera_max_us[p] = espera;
+
+    // Endereço de destino só pode ser trocado com o bloco desabilitado
+    hw->enable = 0;
+    hw->tar = t->endereco;
+    hw->enable = 1;
+
+    if (t->n_leitura) {
+        dma_channel_config c = dma_channel_get_default_config(canal_rx);
+        channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+        channel_config_set_read_increment(&c, false);
+        channel_config_set_write_increment(&c, true);
+        channel_config_set_dreq(&c, i2c_get_dreq(barramento, false));
+        dma_channel_configure(canal_rx, &c, t->leitura, &hw->data_cmd, t->n_leitura, true);
+    }
+
+    dma_channel_config c = dma_channel_get_default_config(canal_tx);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_dreq(&c, i2c_get_dreq(barramento, true));
+    dma_channel_configure(canal_tx, &c, &hw->data_cmd, t->palavras, t->n_palavras, true);
+}
+
+// Tira a primeira transação das filas, da mais prioritária (chamado com a trava)
+static transacao_i2c_t *CAMINHO_RAPIDO(retirar_proxima)(void) {
+    for (int p = 0; p < I2C_PRIORIDADES; p++) {
+        transacao_i2c_t *t = fila_ini[p];
+        if (!t) continue;
+        fila_ini[p] = t->proxima;
+        if (!fila_ini[p]) fila_fim[p] = NULL;
+        t->proxima = NULL;
+        return t;
+    }
+    return NULL;
+}
+
+// Confere se a transação corrente acabou: 1 ok, 0 abortada, -1 em andamento
+static int CAMINHO_RAPIDO(estado_atual)(void) {
+    i2c_hw_t *hw = i2c_get_hw(barramento);
+
+    if (hw->tx_abrt_source) {
+        (void)hw->clr_tx_abrt;   // Leitura limpa o aborto (ex.: NACK)
+        dma_channel_abort(canal_tx);
+        if (atual->n_leitura) dma_channel_abort(canal_rx);
+        return 0;
+    }
+    if (dma_channel_is_busy(canal_tx) || !(hw->status & I2C_IC_STATUS_TFE_BITS) ||
+        (hw->status & I2C_IC_STATUS_ACTIVITY_BITS)) {
+        return -1;
+    }
+    // Depois do STOP os bytes lidos já estão no FIFO RX; o DMA só precisa esvaziá-lo
+    if (atual->n_leitura && dma_channel_is_busy(canal_rx)) return -1;
+    return 1;
+}
+
+// Encerra as transações que terminaram e põe a próxima no barramento
+static void CAMINHO_RAPIDO(verificar)(void) {
+    while (true) {
+        uint32_t salvo = spin_lock_blocking(trava);
+        transacao_i2c_t *t = atual;
+        int r = t ? estado_atual() : -1;
+        if (r < 0) {
+            spin_unlock(trava, salvo);
+            return;
+        }
+
+        uint8_t p = t->prioridade;
+        est.ocupado_us += time_us_32() - atual_inicio_us;
+        if (r) est.concluidas[p]++; else est.abortadas[p]++;
+
+        atual = NULL;
+        transacao_i2c_t *prox = retirar_proxima();
+        if (prox) iniciar_transacao(prox);
+        spin_unlock(trava, salvo);
+
+        // Fora da trava: o callback pode submeter (inclusive a mesma transação)
+        t->ok = r;
+        t->pendente = false;
+        if (t->concluida) t->concluida(t, r);
+    }
+}
+
+static void CAMINHO_RAPIDO(irq_barramento)(void) {
+    memoria_irq_entrada(MEMORIA_IRQ_I2C);
+    i2c_hw_t *hw = i2c_get_hw(barramento);
+    (void)hw->clr_stop_det;
+    verificar();
+}
+
+void barramento_i2c_iniciar(i2c_inst_t *i2c) {
+    if (barramento) return;
+
+    canal_tx = dma_claim_unused_channel(true);
+    canal_rx = dma_claim_unused_channel(true);
+    trava = spin_lock_instance((uint)spin_lock_claim_unused(true));
+    barramento = i2c;
+    est.desde_us = time_us_64();
+
+    i2c_hw_t *hw = i2c_get_hw(i2c);
+    hw->dma_cr = I2C_IC_DMA_CR_TDMAE_BITS | I2C_IC_DMA_CR_RDMAE_BITS;
+    hw->intr_mask = I2C_IC_INTR_MASK_M_STOP_DET_BITS | I2C_IC_INTR_MASK_M_TX_ABRT_BITS;
+
+    uint irq = i2c == i2c0 ? I2C0_IRQ : I2C1_IRQ;
+    irq_set_exclusive_handler(irq, irq_barramento);
+    irq_set_enabled(irq, true);
+}
+
+bool barramento_i2c_submeter(transacao_i2c_t *t) {
+    if (!barramento || t->pendente || t->prioridade >= I2C_PRIORIDADES) return false;
+
+    t->proxima = NULL;
+    t->pendente = true;
+    t->submetida_us = time_us_32();
+
+    uint32_t salvo = spin_lock_blocking(trava);
+    if (!atual) {
+        iniciar_transacao(t);
+    } else {
+        uint8_t p = t->prioridade;
+        if (fila_fim[p]) fila_fim[p]->proxima = t; else fila_ini[p] = t;
+        fila_fim[p] = t;
+    }
+    spin_unlock(trava, salvo);
+    return true;
+}
+
+bool barramento_i2c_executar(transacao_i2c_t *t) {
+    if (!barramento_i2c_submeter(t)) return false;
+    while (t->pendente) {
+        verificar();
+        tight_loop_contents();
+    }
+    return t->ok;
+}
+
+void barramento_i2c_poll(void) {
+    if (barramento) verificar();
+}
+
+bool barramento_i2c_ocupado(void) {
+    return atual != NULL;
+}
+
+uint16_t barramento_i2c_montar(uint16_t *palavras, const uint8_t *escrita, uint16_t n_escrita,
+                               uint16_t n_leitura) {
+    uint16_t n = 0;
+    for (uint16_t i = 0; i < n_escrita; i++) palavras[n++] = escrita[i];
+    for (uint16_t i = 0; i < n_leitura; i++) {
+        uint16_t w = I2C_IC_DATA_CMD_CMD_BITS;
+        if (i == 0 && n_escrita) w |= I2C_IC_DATA_CMD_RESTART_BITS;
+        palavras[n++] = w;
+    }
+    if (n) palavras[n - 1] |= I2C_IC_DATA_CMD_STOP_BITS;
+    return n;
+}
+
+void barramento_i2c_estatisticas(estatisticas_i2c_t *e) {
+    uint32_t salvo = spin_lock_blocking(trava);
+    *e = est;
+    spin_unlock(trava, salvo);
+}
+
+void barramento_i2c_relatorio(void) {
+    static const char *const nomes[I2C_PRIORIDADES] = { "alta", "baixa" };
+    estatisticas_i2c_t e;
+
+    if (!barramento) {
+        printf("Barramento i2c: nao iniciado\n");
+        return;
+    }
+    barramento_i2c_estatisticas(&e);
+
+    uint64_t janela = time_us_64() - e.desde_us;
+    unsigned uso = janela ? (unsigned)(e.ocupado_us * 1000u / janela) : 0;
+    printf("Barramento i2c: ocupado %u.%u%% do tempo\n", uso / 10, uso % 10);
+    for (int p = 0; p < I2C_PRIORIDADES; p++) {
+        printf("  %-5s concluidas %lu | abortadas %lu | espera max %lu us\n", nomes[p],
+               (unsigned long)e.concluidas[p], (unsigned long)e.abortadas[p],
+               (unsigned long)e.espera_max_us[p]);
+    }
+}
@@ -0,0 +1,119 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: barramento_i2c.h
+ *  Projeto: TempCycleDMA
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Árbitro do barramento i2c compartilhado (OLED e
+ *      sensores externos no i2c1).
+ *
+ *      Cada cliente monta uma transação (palavras do
+ *      IC_DATA_CMD, destino da leitura e callback) e a
+ *      submete numa das filas de prioridade. O motor roda as
+ *      transações uma atrás da outra por DMA (TX e RX) e
+ *      passa para a próxima na IRQ do i2c (STOP_DET ou
+ *      TX_ABRT), sem nenhuma tarefa esperando o barramento.
+ *
+ *      Uma transação em andamento não é interrompida: quem
+ *      manda muitos dados (o quadro do OLED) divide o envio
+ *      em várias transações curtas, e uma leitura de alta
+ *      prioridade entra entre duas delas.
+ *
+ *      As filas são protegidas por um spin lock de hardware:
+ *      submeter é seguro de qualquer núcleo e de IRQs.
+ *
+ *
+ *  Data: 14/10/2026
+ * ------------------------------------------------------------
+ */
+
+#ifndef BARRAMENTO_I2C_H
+#define BARRAMENTO_I2C_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "hardware/i2c.h"
+
+typedef enum {
+    I2C_PRIORIDADE_ALTA,        // Leituras de sensores: curtas e com prazo
+    I2C_PRIORIDADE_BAIXA,       // Quadros do OLED
+    I2C_PRIORIDADES
+} prioridade_i2c_t;
+
+typedef struct transacao_i2c transacao_i2c_t;
+
+// Roda na IRQ do i2c (ou em barramento_i2c_poll); pode submeter outra transação
+typedef void (*transacao_concluida_t)(transacao_i2c_t *t, bool ok);
+
+struct transacao_i2c {
+    uint8_t endereco;
+    uint8_t prioridade;              // prioridade_i2c_t
+    const uint16_t *palavras;        // Fluxo do IC_DATA_CMD; a última com STOP
+    uint16_t n_palavras;
+    uint8_t *leitura;                // Bytes lidos (um por palavra com CMD de leitura)
+    uint16_t n_leitura;
+    transacao_concluida_t concluida; // Pode ser NULL
+    void *ctx;
+
+    // Preenchidos pelo motor
+    transacao_i2c_t *proxima;
+    uint32_t submetida_us;
+    volatile bool pendente;          // Na fila ou no barramento
+    bool ok;                         // Resultado da última execução
+};
+
+typedef struct {
+    uint32_t concluidas[I2C_PRIORIDADES];
+    uint32_t abortadas[I2C_PRIORIDADES];      // NACK, perda de arbitragem...
+    uint32_t espera_max_us[I2C_PRIORIDADES];  // Da submissão ao início no barramento
+    uint64_t ocupado_us;                      // Tempo com transação no barramento
+    uint64_t desde_us;                        // Início da medição
+} estatisticas_i2c_t;
+
+/**
+ * @brief Reserva os canais de DMA e liga a IRQ do i2c no núcleo que chamar
+ *        (chamar depois de i2c_init; chamadas extras são ignoradas).
+ */
+void barramento_i2c_iniciar(i2c_inst_t *i2c);
+
+/**
+ * @brief Põe a transação no fim da fila da prioridade dela.
+ *
+ * A transação (e as palavras e o destino da leitura) precisa continuar
+ * válida até 'pendente' voltar a false.
+ *
+ * @return false se ela já estava pendente ou o motor não foi iniciado
+ */
+bool barramento_i2c_submeter(transacao_i2c_t *t);
+
+/**
+ * @brief Submete e espera o fim (só para inicializações, fora do executor).
+ *
+ * @return resultado da transação
+ */
+bool barramento_i2c_executar(transacao_i2c_t *t);
+
+/**
+ * @brief Confere o fim da transação corrente sem depender da IRQ.
+ */
+void barramento_i2c_poll(void);
+
+/**
+ * @brief Indica se há transação no barramento (o ocioso não dorme no meio dela).
+ */
+bool barramento_i2c_ocupado(void);
+
+/**
+ * @brief Monta as palavras de uma escrita seguida (ou não) de leitura.
+ *
+ * A leitura começa com RESTART; a última palavra leva STOP.
+ *
+ * @return número de palavras escritas em 'palavras' (n_escrita + n_leitura)
+ */
+uint16_t barramento_i2c_montar(uint16_t *palavras, const uint8_t *escrita, uint16_t n_escrita,
+                               uint16_t n_leitura);
+
+void barramento_i2c_estatisticas(estatisticas_i2c_t *e);
+void barramento_i2c_relatorio(void);
+
+#endif  // BARRAMENTO_I2C_H
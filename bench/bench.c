@@ -0,0 +1,86 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: bench.c
+ *  Projeto: TempCycleDMA
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Implementação da medição: SysTick em contagem
+ *      regressiva de 24 bits no clock do processador; o custo
+ *      fixo de ler o contador é descontado de cada amostra.
+ *
+ *  
+ *  Data: 14/10/2026
+ * ------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "hardware/clocks.h"
+#include "hardware/structs/systick.h"
+#include "bench.h"
+
+#define SYSTICK_MASCARA 0x00FFFFFFu
+#define LIMITE_SYSTICK_US 100000u   // Abaixo disso o SysTick não dá a volta
+
+static uint32_t custo_medicao = 0;
+
+static void vazio(void *ctx) {
+    (void)ctx;
+}
+
+static uint32_t medir_uma(bench_fn_t fn, void *ctx, uint64_t *us) {
+    uint64_t u0 = time_us_64();
+    uint32_t t0 = systick_hw->cvr;
+    fn(ctx);
+    uint32_t t1 = systick_hw->cvr;
+    uint64_t du = time_us_64() - u0;
+    *us = du;
+
+    if (du >= LIMITE_SYSTICK_US) {
+        return (uint32_t)(du * (clock_get_hz(clk_sys) / 1000000u));
+    }
+    uint32_t ciclos = (t0 - t1) & SYSTICK_MASCARA;
+    return ciclos > custo_medicao ? ciclos - custo_medicao : 0;
+}
+
+void bench_iniciar(void) {
+    systick_hw->rvr = SYSTICK_MASCARA;
+    systick_hw->cvr = 0;
+    systick_hw->csr = 0x5;   // ENABLE | CLKSOURCE (processador), sem IRQ
+
+    uint64_t us;
+    uint32_t menor = UINT32_MAX;
+    for (int i = 0; i < 16; i++) {
+        uint32_t c = medir_uma(vazio, NULL, &us);
+        if (c < menor) menor = c;
+    }
+    custo_medicao = menor;
+}
+
+void bench_cabecalho(void) {
+    printf("# clk_sys_hz=%lu custo_medicao=%lu\n",
+           (unsigned long)clock_get_hz(clk_sys), (unsigned long)custo_medicao);
+    printf("bench,iteracoes,ciclos_medio,ciclos_min,ciclos_max,us_total\n");
+}
+
+void bench_rodar(const char *nome, uint32_t iteracoes,
+                 bench_fn_t preparar, bench_fn_t medir, void *ctx) {
+    uint64_t total = 0, us_total = 0, us;
+    uint32_t menor = UINT32_MAX, maior = 0;
+
+    if (preparar) preparar(ctx);
+    (void)medir_uma(medir, ctx, &us);   // Aquecimento (cache XIP, primeira chamada)
+
+    for (uint32_t i = 0; i < iteracoes; i++) {
+        if (preparar) preparar(ctx);
+        uint32_t c = medir_uma(medir, ctx, &us);
+        total += c;
+        us_total += us;
+        if (c < menor) menor = c;
+        if (c > maior) maior = c;
+    }
+
+    printf("%s,%lu,%lu,%lu,%lu,%llu\n", nome, (unsigned long)iteracoes,
+           (unsigned long)(total / iteracoes), (unsigned long)menor,
+           (unsigned long)maior, (unsigned long long)us_total);
+}
@@ -0,0 +1,59 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: bench.h
+ *  Projeto: TempCycleDMA
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Medição de microbenchmarks no RP2040 para o alvo
+ *      TempCycleDMA_bench. Cada caso roda N vezes; o tempo de
+ *      cada execução é medido em ciclos de CPU pelo SysTick
+ *      (24 bits) ou, acima de ~100 ms, pelo timer de µs.
+ *
+ *      Saída em CSV pelo USB:
+ *          bench,iteracoes,ciclos_medio,ciclos_min,ciclos_max,us_total
+ *
+ *  
+ *  Data: 14/10/2026
+ * ------------------------------------------------------------
+ */
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stdint.h>
+
+typedef void (*bench_fn_t)(void *ctx);
+
+#define BENCH_BLOCO 256   // Amostras do bloco dos casos portáveis
+
+// Resultado dos casos medidos: impede que o compilador descarte o trabalho
+extern volatile int32_t bench_sorvedouro;
+
+// Liga o SysTick no clock do processador e mede o custo da própria medição
+void bench_iniciar(void);
+
+// Imprime a linha de cabeçalho do CSV (com o clk_sys em comentário)
+void bench_cabecalho(void);
+
+/**
+ * @brief Roda um caso e imprime uma linha do CSV.
+ *
+ * @param nome Identificador estável do caso (chave para comparar builds)
+ * @param iteracoes Execuções medidas (mais uma de aquecimento)
+ * @param preparar Chamado antes de cada execução, fora da medição (pode ser NULL)
+ * @param medir Trecho medido
+ * @param ctx Repassado às duas funções
+ */
+void bench_rodar(const char *nome, uint32_t iteracoes,
+                 bench_fn_t preparar, bench_fn_t medir, void *ctx);
+
+/**
+ * @brief Roda os casos sem periféricos ('bench_casos.c'): redução,
+ *        conversão e fonte grande.
+ *
+ * @param bloco BENCH_BLOCO contagens (NULL: bloco sintético perto de 25 °C)
+ * @param iteracoes Execuções dos casos rápidos (as conversões por amostra usam 1/4)
+ */
+void bench_casos_portateis(const uint16_t *bloco, uint32_t iteracoes);
+
+#endif  // BENCH_H
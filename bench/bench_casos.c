@@ -0,0 +1,99 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: bench_casos.c
+ *  Projeto: TempCycleDMA
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Casos de benchmark que não usam periféricos: redução
+ *      de um bloco (1 e 5 canais, com e sem histograma),
+ *      conversão em float x ponto fixo e desenho da fonte
+ *      grande num quadro próprio.
+ *
+ *  Relacionamento:
+ *      - Rodados pelo alvo TempCycleDMA_bench ('bench_main.c')
+ *        sobre um bloco capturado do ADC
+ *      - e pelo comando 'bench' do console ('console.c'), com
+ *        um bloco sintético e a aquisição rodando
+ *
+ *
+ *  Data: 14/10/2026
+ * ------------------------------------------------------------
+ */
+
+#include "pico/stdlib.h"
+#include "bench.h"
+#include "reducao.h"
+#include "ssd1306.h"
+#include "display_utils.h"
+
+volatile int32_t bench_sorvedouro;
+
+static const uint16_t *amostras;
+static uint16_t sinteticas[BENCH_BLOCO];
+static uint8_t quadro[ssd1306_buffer_length];
+static const calib_temp_t calib = CALIB_TEMP_PADRAO;
+
+static void reduzir(void *ctx) {
+    reducao_bloco_t r;
+    bench_sorvedouro = reducao_bloco(amostras, BENCH_BLOCO, (uint8_t)(uintptr_t)ctx, 0, &r);
+    bench_sorvedouro += r.soma[0];
+}
+
+// Mesma passada com o histograma do sensor (mediana e média aparada)
+static void reduzir_hist(void *ctx) {
+    static reducao_hist_t hist;
+    reducao_bloco_t r;
+    (void)ctx;
+    reducao_hist_iniciar(&hist, amostras[0]);
+    reducao_bloco_hist(amostras, BENCH_BLOCO, 1, 0, &hist, 0, &r);
+    bench_sorvedouro = r.soma_q[0];
+}
+
+// Conversão por amostra como era feita antes do ponto fixo
+static void conv_float(void *ctx) {
+    (void)ctx;
+    float soma = 0.0f;
+    for (int i = 0; i < BENCH_BLOCO; i++) {
+        float v = amostras[i] * 3.3f / 4096.0f;
+        soma += 27.0f - (v - 0.706f) / 0.001721f;
+    }
+    bench_sorvedouro = (int32_t)(soma / BENCH_BLOCO * 1000.0f);
+}
+
+static void conv_fixa_por_amostra(void *ctx) {
+    (void)ctx;
+    int32_t soma = 0;
+    for (int i = 0; i < BENCH_BLOCO; i++) {
+        soma += reducao_media_mC(&calib, amostras[i], 1);
+    }
+    bench_sorvedouro = soma / BENCH_BLOCO;
+}
+
+static void conv_fixa_janela(void *ctx) {
+    (void)ctx;
+    uint64_t soma = 0;
+    for (int i = 0; i < BENCH_BLOCO; i++) soma += amostras[i];
+    bench_sorvedouro = reducao_media_mC(&calib, soma, BENCH_BLOCO);
+}
+
+static void desenhar_valor_grande(void *ctx) {
+    (void)ctx;
+    mostrar_valor_grande(quadro, -12300, 32);
+}
+
+void bench_casos_portateis(const uint16_t *bloco, uint32_t iteracoes) {
+    if (!bloco) {
+        // Perto da leitura do sensor a 25 °C
+        for (int i = 0; i < BENCH_BLOCO; i++) sinteticas[i] = (uint16_t)(876 + (i * 7) % 9);
+        bloco = sinteticas;
+    }
+    amostras = bloco;
+
+    bench_rodar("reducao_1canal_256", iteracoes, NULL, reduzir, (void *)1);
+    bench_rodar("reducao_hist_1canal_256", iteracoes, NULL, reduzir_hist, NULL);
+    bench_rodar("reducao_5canais_256", iteracoes, NULL, reduzir, (void *)5);
+    bench_rodar("conv_float_256", iteracoes / 4, NULL, conv_float, NULL);
+    bench_rodar("conv_fixa_256", iteracoes / 4, NULL, conv_fixa_por_amostra, NULL);
+    bench_rodar("conv_fixa_janela_256", iteracoes, NULL, conv_fixa_janela, NULL);
+    bench_rodar("mostrar_valor_grande", iteracoes, NULL, desenhar_valor_grande, NULL);
+}
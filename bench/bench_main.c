@@ -0,0 +1,200 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: bench_main.c
+ *  Projeto: TempCycleDMA
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Firmware de benchmark (alvo TempCycleDMA_bench): mede
+ *      os caminhos quentes do projeto na placa e imprime um
+ *      CSV pelo USB, para comparar builds antes de gravar o
+ *      firmware principal.
+ *
+ *      Casos:
+ *         - aquisição de um bloco ADC + DMA e sua redução
+ *           (1 e 5 canais)
+ *         - conversão em float (fórmula antiga) x ponto fixo
+ *         - envio ao OLED (quadro inteiro e só a diferença)
+ *         - desenho da fonte grande
+ *         - envio à matriz NeoPixel e efeitos
+ *         - análise de tendência
+ *
+ *      O CSV sai assim que o USB conecta e de novo a cada
+ *      'b' recebido.
+ *
+ *  Relacionamento:
+ *      - Usa os mesmos módulos do firmware principal, exceto
+ *        main.c/setup.c (sem executor e sem a aquisição
+ *        contínua, que disputaria o ADC)
+ *      - Os casos sem periféricos ficam em 'bench_casos.c',
+ *        também usados pelo comando 'bench' do console
+ *
+ *
+ *  Data: 14/10/2026
+ * ------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "pico/stdio_usb.h"
+#include "hardware/adc.h"
+#include "hardware/dma.h"
+#include "hardware/i2c.h"
+#include "bench.h"
+#include "reducao.h"
+#include "ssd1306.h"
+#include "draw_big_char.h"
+#include "display_utils.h"
+#include "tarefa3_tendencia.h"
+#include "neopixel_driver.h"
+#include "animacao.h"
+#include "efeitos.h"
+#include "testes_cores.h"
+
+static uint16_t amostras[BENCH_BLOCO];
+static uint8_t quadro[ssd1306_buffer_length];
+static struct render_area tela = {
+    .start_column = 0,
+    .end_column = ssd1306_width - 1,
+    .start_page = 0,
+    .end_page = ssd1306_n_pages - 1
+};
+static int canal_adc_dma;
+
+// === Aquisição (redução e conversão em bench_casos.c) ===
+
+static void adc_bloco(void *ctx) {
+    (void)ctx;
+    adc_fifo_drain();
+    dma_channel_config c = dma_channel_get_default_config(canal_adc_dma);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, true);
+    channel_config_set_dreq(&c, DREQ_ADC);
+    dma_channel_configure(canal_adc_dma, &c, amostras, &adc_hw->fifo, BENCH_BLOCO, true);
+    adc_run(true);
+    dma_channel_wait_for_finish_blocking(canal_adc_dma);
+    adc_run(false);
+}
+
+// === OLED ===
+
+static void oled_quadro_inteiro(void *ctx) {
+    (void)ctx;
+    render_on_display(quadro, &tela);
+}
+
+static void oled_mudar_digitos(void *ctx) {
+    static int n = 0;
+    (void)ctx;
+    ssd1306_flush_aguardar();
+    memset(quadro, 0, sizeof(quadro));
+    mostrar_valor_grande(quadro, 20000 + (n++ % 10) * 100, 32);
+}
+
+static void oled_flush_diferenca(void *ctx) {
+    (void)ctx;
+    ssd1306_flush_alteracoes(quadro, NULL);
+    ssd1306_flush_aguardar();
+}
+
+static void desenhar_big_char(void *ctx) {
+    draw_big_char(quadro, 40, (int)(uintptr_t)ctx, big_digit_8_pag);
+}
+
+// === NeoPixel ===
+
+static void np_alternar(void *ctx) {
+    static bool claro = false;
+    (void)ctx;
+    while (!npQuadroConcluido()) npPoll();
+    claro = !claro;
+    npSetAll(claro ? COR_MAX : 0, 0, COR_MEIA);
+}
+
+static void np_write(void *ctx) {
+    (void)ctx;
+    npWrite();
+}
+
+static void np_write_async(void *ctx) {
+    (void)ctx;
+    npWriteAsync();
+}
+
+static void efeito_tick_espiral(void *ctx) {
+    static uint32_t agora_ms = 0;
+    (void)ctx;
+    agora_ms += 1000;   // Sempre vencido: cada chamada desenha, compõe e empacota
+    efeito_tick(agora_ms);
+}
+
+static void efeito_espiral_bloqueante(void *ctx) {
+    (void)ctx;
+    efeitoEspiral(COR_MAX, 0, 0, 0);
+}
+
+// === Tendência ===
+
+static void tendencia(void *ctx) {
+    static int n = 0;
+    (void)ctx;
+    bench_sorvedouro = tarefa3_analisa_tendencia(25.0f + (n++ % 7) * 0.01f);
+}
+
+static void rodar_todos(void) {
+    bench_cabecalho();
+
+    adc_set_clkdiv(0);   // ADC livre (~500 ksps), para o custo não ser o do divisor
+    adc_select_input(ADC_CANAL_TEMP);
+    bench_rodar("adc_dma_bloco_256", 32, NULL, adc_bloco, NULL);
+    bench_casos_portateis(amostras, 256);   // Redução, conversão e fonte grande sobre o bloco lido
+
+    bench_rodar("render_on_display", 16, NULL, oled_quadro_inteiro, NULL);
+    bench_rodar("flush_alteracoes_digitos", 16, oled_mudar_digitos, oled_flush_diferenca, NULL);
+    bench_rodar("draw_big_char_y32", 256, NULL, desenhar_big_char, (void *)32);
+    bench_rodar("draw_big_char_y29", 256, NULL, desenhar_big_char, (void *)29);
+
+    bench_rodar("npWrite", 32, np_alternar, np_write, NULL);
+    bench_rodar("npWriteAsync", 32, np_alternar, np_write_async, NULL);
+    const anim_efeito_t espiral = { ANIM_ESPIRAL, COR_MAX, 0, 0, 10, true };
+    anim_iniciar(ANIM_CAMADA_BASE, &espiral, 0);
+    bench_rodar("efeito_tick_espiral", 64, np_alternar, efeito_tick_espiral, NULL);
+    anim_parar(ANIM_CAMADA_BASE);
+    bench_rodar("efeitoEspiral_bloqueante", 4, NULL, efeito_espiral_bloqueante, NULL);
+
+    bench_rodar("tarefa3_analisa_tendencia", 256, NULL, tendencia, NULL);
+    printf("# fim\n");
+}
+
+int main() {
+    stdio_init_all();
+
+    adc_init();
+    adc_set_temp_sensor_enabled(true);
+    adc_fifo_setup(true, true, 1, false, false);
+    canal_adc_dma = dma_claim_unused_channel(true);
+
+    i2c_init(i2c1, 400 * 1000);
+    gpio_set_function(14, GPIO_FUNC_I2C);
+    gpio_set_function(15, GPIO_FUNC_I2C);
+    gpio_pull_up(14);
+    gpio_pull_up(15);
+    ssd1306_init();
+    calculate_render_area_buffer_length(&tela);
+
+    npInit(LED_PIN);
+    bench_iniciar();
+
+    while (!stdio_usb_connected()) {
+        sleep_ms(100);
+    }
+    sleep_ms(500);   // Dá tempo ao terminal de abrir a porta
+
+    while (true) {
+        rodar_todos();
+        while (getchar_timeout_us(1000000) != 'b') {
+            tight_loop_contents();
+        }
+    }
+}
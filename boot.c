@@ -0,0 +1,70 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: boot.c
+ *  Projeto: TempCycleDMA
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Implementação do sequenciador do boot.
+ *
+ *  Relacionamento:
+ *      - Etapas do setup em 'setup.c'
+ *      - Primeira janela marcada pela tarefa 1 em 'main.c'
+ *      - Relatório no console ('console.c') e ao conectar o USB
+ *
+ *
+ *  Data: 14/10/2026
+ * ------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "boot.h"
+
+static const etapa_boot_t *tabela = NULL;
+static estatisticas_boot_t est;
+
+bool boot_executar(const etapa_boot_t *etapas, uint8_t n) {
+    if (tabela) return false;
+    tabela = etapas;
+
+    if (n > BOOT_MAX_ETAPAS) n = BOOT_MAX_ETAPAS;
+    est.n_etapas = n;
+    est.inicio_us = time_us_64();
+
+    uint64_t t = est.inicio_us;
+    for (uint8_t i = 0; i < n; i++) {
+        etapas[i].executar();
+        uint64_t agora = time_us_64();
+        est.duracao_us[i] = (uint32_t)(agora - t);
+        t = agora;
+    }
+    est.fim_us = t;
+    return true;
+}
+
+void boot_primeira_amostra(void) {
+    if (!est.primeira_amostra_us) est.primeira_amostra_us = time_us_64();
+}
+
+void boot_estatisticas(estatisticas_boot_t *e) {
+    *e = est;
+}
+
+void boot_relatorio(void) {
+    if (!tabela) {
+        printf("Boot: setup nao rodou\n");
+        return;
+    }
+
+    printf("Boot: setup %lu us (de %lu a %lu us desde o reset)\n",
+           (unsigned long)(est.fim_us - est.inicio_us), (unsigned long)est.inicio_us,
+           (unsigned long)est.fim_us);
+    for (uint8_t i = 0; i < est.n_etapas; i++) {
+        printf("  %-12s %7lu us\n", tabela[i].nome, (unsigned long)est.duracao_us[i]);
+    }
+    if (est.primeira_amostra_us) {
+        printf("  primeira janela aos %lu ms do reset\n", (unsigned long)(est.primeira_amostra_us / 1000u));
+    } else {
+        printf("  nenhuma janela ainda\n");
+    }
+}
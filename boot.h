@@ -0,0 +1,61 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: boot.h
+ *  Projeto: TempCycleDMA
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Sequenciador do boot.
+ *
+ *      O setup é uma tabela de etapas (nome + função) rodada
+ *      uma única vez, na ordem: a aquisição começa logo depois
+ *      dos parâmetros, e o OLED, a matriz e o resto iniciam
+ *      com o DMA do ADC já enchendo o primeiro bloco. Cada
+ *      etapa tem a duração medida; a tarefa de aquisição marca
+ *      a primeira janela válida, e o relatório mostra o tempo
+ *      desde o reset até ela.
+ *
+ *
+ *  Data: 14/10/2026
+ * ------------------------------------------------------------
+ */
+
+#ifndef BOOT_H
+#define BOOT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define BOOT_MAX_ETAPAS 16
+
+typedef struct {
+    const char *nome;
+    void (*executar)(void);
+} etapa_boot_t;
+
+typedef struct {
+    uint8_t n_etapas;
+    uint32_t duracao_us[BOOT_MAX_ETAPAS];
+    uint64_t inicio_us;              // Primeira etapa (tempo desde o reset)
+    uint64_t fim_us;                 // Fim da última etapa
+    uint64_t primeira_amostra_us;    // 0 = nenhuma janela ainda
+} estatisticas_boot_t;
+
+/**
+ * @brief Roda as etapas em ordem, medindo cada uma.
+ *
+ * Só a primeira chamada tem efeito: um segundo setup não repete nenhuma
+ * inicialização.
+ *
+ * @return false se o boot já tinha rodado
+ */
+bool boot_executar(const etapa_boot_t *etapas, uint8_t n);
+
+/**
+ * @brief Marca a primeira janela válida (chamadas seguintes são ignoradas).
+ */
+void boot_primeira_amostra(void);
+
+void boot_estatisticas(estatisticas_boot_t *e);
+void boot_relatorio(void);
+
+#endif  // BOOT_H
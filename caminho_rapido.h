@@ -0,0 +1,57 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: caminho_rapido.h
+ *  Projeto: TempCycleDMA
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Perfil de build TEMPCYCLE_FAST_PATH: o caminho quente
+ *      roda da SRAM em vez da flash (XIP).
+ *
+ *      Com o perfil desligado as marcas não fazem nada. Ligado,
+ *      as funções marcadas com CAMINHO_RAPIDO vão para a
+ *      seção .time_critical (copiada para a SRAM no boot), as
+ *      tabelas TABELA_RAPIDA idem, e os acumuladores da
+ *      aquisição (DADOS_AQUISICAO) ficam num banco scratch: o
+ *      X, do núcleo 1, no modo TEMPCYCLE_DUAL_CORE, ou o Y, do
+ *      núcleo 0 — bancos que o DMA do ADC, gravando na SRAM
+ *      principal, não disputa.
+ *
+ *      O CMake liga junto PICO_DIVIDER_IN_RAM, PICO_BITS_IN_RAM
+ *      e PICO_MEM_IN_RAM, para que divisões, __builtin_clz e
+ *      memset chamados no caminho quente também não busquem
+ *      código na flash. O efeito aparece nos contadores do
+ *      cache do XIP ('instr_relatorio', comando 'i').
+ *
+ *
+ *  Data: 14/10/2026
+ * ------------------------------------------------------------
+ */
+
+#ifndef CAMINHO_RAPIDO_H
+#define CAMINHO_RAPIDO_H
+
+#include "pico.h"
+
+#ifndef TEMPCYCLE_FAST_PATH
+#define TEMPCYCLE_FAST_PATH 0
+#endif
+
+#ifndef TEMPCYCLE_DUAL_CORE
+#define TEMPCYCLE_DUAL_CORE 0
+#endif
+
+#if TEMPCYCLE_FAST_PATH
+#define CAMINHO_RAPIDO(f) __not_in_flash_func(f)
+#define TABELA_RAPIDA __not_in_flash("tabelas")
+#if TEMPCYCLE_DUAL_CORE
+#define DADOS_AQUISICAO __scratch_x("aquisicao")
+#else
+#define DADOS_AQUISICAO __scratch_y("aquisicao")
+#endif
+#else
+#define CAMINHO_RAPIDO(f) f
+#define TABELA_RAPIDA
+#define DADOS_AQUISICAO
+#endif
+
+#endif  // CAMINHO_RAPIDO_H
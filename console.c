@@ -0,0 +1,241 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: console.c
+ *  Projeto: TempCycleDMA
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Implementação do console de comandos.
+ *
+ *      Cada chamada de console_poll() consome no máximo
+ *      CONSOLE_CARACTERES_POR_POLL caracteres, com eco e
+ *      backspace. A linha é separada em até três palavras e
+ *      despachada pela tabela de comandos.
+ *
+ *      O 'bench' roda no ocioso, então só mede os caminhos
+ *      que não disputam periféricos com o firmware (redução,
+ *      conversão, desenho em um quadro à parte); ADC, OLED e
+ *      matriz continuam no alvo TempCycleDMA_bench. Ele pode
+ *      estourar o quadro em que roda.
+ *
+ *  Relacionamento:
+ *      - Chamado pelo ocioso em 'main.c'
+ *      - Parâmetros de 'parametros.c'
+ *      - Relatórios de 'instrumentacao.c', 'executor.c',
+ *        'energia.c', 'supervisor.c', 'barramento_i2c.c' e
+ *        'boot.c'
+ *      - Medição de 'bench/bench.c'
+ *
+ *
+ *  Data: 14/10/2026
+ * ------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "console.h"
+#include "parametros.h"
+#include "executor.h"
+#include "instrumentacao.h"
+#include "energia.h"
+#include "supervisor.h"
+#include "barramento_i2c.h"
+#include "telemetria_rede.h"
+#include "boot.h"
+#include "memoria.h"
+#include "bench.h"
+
+#define CONSOLE_MAX_PALAVRAS 3
+
+typedef struct {
+    const char *nome;
+    uint8_t argumentos;         // Palavras depois do nome
+    void (*executar)(char **arg);
+    const char *ajuda;
+} comando_t;
+
+static char linha[CONSOLE_LINHA_MAX];
+static uint8_t n_linha = 0;
+static bool transbordou = false;
+
+// === Parâmetros ===
+
+static void cmd_lista(char **arg) {
+    parametros_listar(arg[0]);
+}
+
+static void cmd_get(char **arg) {
+    const parametro_t *p = parametros_buscar(arg[0]);
+    if (!p) {
+        printf("parametro desconhecido: %s\n", arg[0]);
+        return;
+    }
+    printf("%s = %ld\n", p->nome, (long)parametros_ler(p));
+}
+
+static void cmd_set(char **arg) {
+    static const char *const erros[] = {
+        [PARAM_DESCONHECIDO] = "parametro desconhecido",
+        [PARAM_INVALIDO] = "valor invalido",
+        [PARAM_FORA_DA_FAIXA] = "fora da faixa",
+        [PARAM_RECUSADO] = "recusado pelo modulo (valor anterior mantido)",
+    };
+
+    resultado_parametro_t r = parametros_definir(arg[0], arg[1]);
+    if (r == PARAM_OK) {
+        cmd_get(arg);
+    } else {
+        printf("%s: %s\n", arg[0], erros[r]);
+    }
+}
+
+static void cmd_salvar(char **arg) {
+    (void)arg;
+    printf(parametros_salvar() ? "parametros salvos\n" : "falha ao gravar a flash\n");
+}
+
+static void cmd_padrao(char **arg) {
+    (void)arg;
+    printf(parametros_apagar() ? "valores salvos apagados (padroes no proximo boot)\n"
+                               : "falha ao apagar a flash\n");
+}
+
+// === Relatórios ===
+
+static void cmd_instr(char **arg)      { (void)arg; instr_relatorio(); }
+static void cmd_executor(char **arg)   { (void)arg; executor_relatorio(); }
+static void cmd_energia(char **arg)    { (void)arg; energia_relatorio(); }
+static void cmd_supervisor(char **arg) { (void)arg; supervisor_relatorio(); }
+static void cmd_i2c(char **arg)        { (void)arg; barramento_i2c_relatorio(); }
+static void cmd_boot(char **arg)       { (void)arg; boot_relatorio(); }
+static void cmd_memoria(char **arg)    { (void)arg; memoria_relatorio(); }
+#if TEMPCYCLE_WIFI
+static void cmd_rede(char **arg)       { (void)arg; rede_relatorio(); }
+#endif
+
+static void cmd_zerar(char **arg) {
+    (void)arg;
+    instr_zerar();
+    energia_zerar();
+}
+
+static void cmd_stats(char **arg) {
+    instr_relatorio();
+    executor_relatorio();
+    energia_relatorio();
+    supervisor_relatorio();
+    barramento_i2c_relatorio();
+    memoria_relatorio();
+#if TEMPCYCLE_WIFI
+    rede_relatorio();
+#endif
+    (void)arg;
+}
+
+// === Benchmarks ===
+
+static void cmd_bench(char **arg) {
+    static bool iniciado = false;
+    (void)arg;
+
+    if (!iniciado) {
+        iniciado = true;
+        bench_iniciar();
+    }
+    bench_cabecalho();
+    bench_casos_portateis(NULL, 64);   // Os mesmos casos de TempCycleDMA_bench, bloco sintético
+    printf("# fim\n");
+}
+
+// === Despacho ===
+
+static void cmd_ajuda(char **arg);
+
+static const comando_t comandos[] = {
+    { "ajuda",  0, cmd_ajuda,      "esta lista" },
+    { "lista",  1, cmd_lista,      "[prefixo]  parametros, valores e faixas" },
+    { "get",    1, cmd_get,        "<nome>  le um parametro" },
+    { "set",    2, cmd_set,        "<nome> <valor>  escreve e aplica (decimal ou 0x)" },
+    { "salvar", 0, cmd_salvar,     "grava os valores atuais na flash" },
+    { "padrao", 0, cmd_padrao,     "apaga os valores salvos" },
+    { "stats",  0, cmd_stats,      "todos os relatorios" },
+    { "i",      0, cmd_instr,      "instrumentacao (duracao/jitter)" },
+    { "e",      0, cmd_executor,   "tabela do executor" },
+    { "p",      0, cmd_energia,    "ciclo de trabalho (energia)" },
+    { "s",      0, cmd_supervisor, "supervisor e causa do ultimo reset" },
+    { "boot",   0, cmd_boot,       "duracao das etapas do boot e primeira janela" },
+    { "i2c",    0, cmd_i2c,        "barramento i2c (filas, abortos, ocupacao)" },
+    { "m",      0, cmd_memoria,    "pilhas, heap e buffers estaticos (RAM)" },
+#if TEMPCYCLE_WIFI
+    { "rede",   0, cmd_rede,       "enlace e lotes da telemetria UDP" },
+#endif
+    { "z",      0, cmd_zerar,      "zera instrumentacao e energia" },
+    { "bench",  0, cmd_bench,      "microbenchmarks (CSV)" },
+};
+
+static void cmd_ajuda(char **arg) {
+    (void)arg;
+    for (unsigned i = 0; i < count_of(comandos); i++) {
+        printf("  %-7s %s\n", comandos[i].nome, comandos[i].ajuda);
+    }
+}
+
+static void executar_linha(char *s) {
+    char *palavras[CONSOLE_MAX_PALAVRAS] = { NULL };
+    uint8_t n = 0;
+
+    while (*s && n < CONSOLE_MAX_PALAVRAS) {
+        while (*s == ' ') s++;
+        if (!*s) break;
+        palavras[n++] = s;
+        while (*s && *s != ' ') s++;
+        if (*s) *s++ = '\0';
+    }
+    if (n == 0) return;
+
+    for (unsigned i = 0; i < count_of(comandos); i++) {
+        const comando_t *c = &comandos[i];
+        if (strcmp(c->nome, palavras[0]) != 0) continue;
+        // 'lista' aceita o prefixo opcional; os demais exigem todos os argumentos
+        if (n - 1 < c->argumentos && c->executar != cmd_lista) {
+            printf("uso: %s %s\n", c->nome, c->ajuda);
+            return;
+        }
+        c->executar(&palavras[1]);
+        return;
+    }
+    printf("comando desconhecido: %s (ajuda lista os comandos)\n", palavras[0]);
+}
+
+void console_poll(void) {
+    for (int k = 0; k < CONSOLE_CARACTERES_POR_POLL; k++) {
+        int c = getchar_timeout_us(0);
+        if (c == PICO_ERROR_TIMEOUT) return;
+
+        if (c == '\r' || c == '\n') {
+            if (n_linha == 0 && !transbordou) continue;   // CR+LF vira uma só linha
+            printf("\n");
+            linha[n_linha] = '\0';
+            if (transbordou) {
+                printf("linha longa demais (max %d)\n", CONSOLE_LINHA_MAX - 1);
+            } else {
+                executar_linha(linha);
+            }
+            n_linha = 0;
+            transbordou = false;
+            printf("> ");
+        } else if (c == '\b' || c == 0x7F) {
+            if (n_linha) {
+                n_linha--;
+                printf("\b \b");
+            }
+        } else if (c >= ' ' && c < 0x7F) {
+            if (n_linha < CONSOLE_LINHA_MAX - 1) {
+                linha[n_linha++] = (char)c;
+                putchar(c);
+            } else {
+                transbordou = true;
+            }
+        }
+    }
+}
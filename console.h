@@ -0,0 +1,44 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: console.h
+ *  Projeto: TempCycleDMA
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Console de comandos pelo USB (stdio), lido sem
+ *      bloquear no ocioso do executor.
+ *
+ *      Os caracteres chegam por getchar_timeout_us(0) para
+ *      um buffer de linha; o comando só roda no Enter.
+ *      Comandos:
+ *
+ *         ajuda                  lista os comandos
+ *         lista [prefixo]        parâmetros e valores
+ *         get <nome>             lê um parâmetro
+ *         set <nome> <valor>     escreve e aplica na hora
+ *         salvar | padrao        grava / apaga os valores na flash
+ *         stats                  todos os relatórios
+ *         i | e | p | s | z      instrumentação, executor, energia,
+ *                                supervisor, zerar contadores
+ *         boot                   etapas do boot e primeira janela
+ *         i2c                    filas e ocupação do barramento i2c
+ *         m                      pilhas, heap e buffers estáticos
+ *         rede                   telemetria UDP (só com TEMPCYCLE_WIFI)
+ *         bench                  microbenchmarks sem parar a aquisição
+ *
+ *
+ *  Data: 14/10/2026
+ * ------------------------------------------------------------
+ */
+
+#ifndef CONSOLE_H
+#define CONSOLE_H
+
+#define CONSOLE_LINHA_MAX 64
+#define CONSOLE_CARACTERES_POR_POLL 16   // Limita o tempo de cada chamada no ocioso
+
+/**
+ * @brief Lê o que chegou pelo USB e executa a linha ao receber Enter.
+ */
+void console_poll(void);
+
+#endif  // CONSOLE_H
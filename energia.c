@@ -0,0 +1,120 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: energia.c
+ *  Projeto: TempCycleDMA
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Sono no ocioso do executor e troca de clock durante o
+ *      sono, com medição do ciclo de trabalho.
+ *
+ *      O sono é um laço de 'best_effort_wfe_or_timeout': as
+ *      IRQs (DMA do ADC, USB) acordam o núcleo, são atendidas
+ *      e ele volta a dormir até o prazo. Com clock reduzido o
+ *      prazo é antecipado em ENERGIA_MARGEM_CLOCK_US para a
+ *      PLL voltar antes do início do quadro.
+ *
+ *  Relacionamento:
+ *      - Configurado em 'setup.c' (cfg_energia)
+ *      - Chamado pelo ocioso em 'main.c' quando não há
+ *        trabalho pendente
+ *      - Tempo de ADC ligado vem de 'tarefa1_temp.c'
+ *
+ *
+ *  Data: 14/10/2026
+ * ------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "hardware/clocks.h"
+#include "hardware/i2c.h"
+#include "energia.h"
+#include "setup.h"
+#include "tarefa1_temp.h"
+#include "neopixel_driver.h"
+
+#define ENERGIA_MARGEM_CLOCK_US 500u   // Volta ao clock de trabalho (relock da PLL)
+
+static config_energia_t cfg = CONFIG_ENERGIA_PADRAO;
+static uint32_t clock_trabalho_khz = 0;
+
+static uint64_t inicio_medicao_us;
+static uint64_t dormindo_us, clock_reduzido_us, adc_base_us;
+static uint32_t sonos, trocas_clock;
+
+static void trocar_clock(uint32_t khz) {
+    set_sys_clock_khz(khz, true);
+    i2c_set_baudrate(i2c1, OLED_I2C_HZ);
+    npAjustarClock();
+}
+
+void energia_configurar(const config_energia_t *c) {
+    config_energia_t nova = *c;
+    clock_trabalho_khz = clock_get_hz(clk_sys) / 1000u;
+
+    if (nova.clock_sono_khz) {
+        uint vco, div1, div2;
+        if (nova.clock_sono_khz < ENERGIA_CLOCK_MIN_KHZ) nova.clock_sono_khz = ENERGIA_CLOCK_MIN_KHZ;
+        if (nova.clock_sono_khz >= clock_trabalho_khz ||
+            !check_sys_clock_khz(nova.clock_sono_khz, &vco, &div1, &div2)) {
+            nova.clock_sono_khz = 0;   // Inalcançável pela PLL ou sem ganho
+        }
+    }
+    cfg = nova;
+    energia_zerar();
+}
+
+void energia_dormir(uint32_t folga_us) {
+    if (!cfg.dormir_no_ocioso || folga_us < ENERGIA_SONO_MIN_US) return;
+    if (folga_us > ENERGIA_SONO_MAX_US) folga_us = ENERGIA_SONO_MAX_US;
+
+    absolute_time_t inicio = get_absolute_time();
+    bool reduzir = cfg.clock_sono_khz && folga_us >= ENERGIA_FOLGA_CLOCK_US;
+    absolute_time_t prazo = delayed_by_us(inicio, reduzir ? folga_us - ENERGIA_MARGEM_CLOCK_US : folga_us);
+
+    if (reduzir) trocar_clock(cfg.clock_sono_khz);
+
+    absolute_time_t adormeceu = get_absolute_time();
+    while (!best_effort_wfe_or_timeout(prazo)) {
+        // IRQ atendida; nada para a thread até o prazo
+    }
+    dormindo_us += absolute_time_diff_us(adormeceu, get_absolute_time());
+    sonos++;
+
+    if (reduzir) {
+        trocar_clock(clock_trabalho_khz);
+        clock_reduzido_us += absolute_time_diff_us(inicio, get_absolute_time());
+        trocas_clock++;
+    }
+}
+
+// Parte por mil, para imprimir sem float
+static uint32_t por_mil(uint64_t parte, uint64_t total) {
+    return total ? (uint32_t)(parte * 1000u / total) : 0;
+}
+
+void energia_relatorio(void) {
+    uint64_t total = time_us_64() - inicio_medicao_us;
+    uint32_t cpu = 1000u - por_mil(dormindo_us, total);
+    uint32_t reduzido = por_mil(clock_reduzido_us, total);
+    uint32_t adc = por_mil(tarefa1_adc_ligado_us() - adc_base_us, total);
+
+    printf("Energia: sono %s | clock %lu kHz, no sono %lu kHz | medido em %lu ms\n",
+           cfg.dormir_no_ocioso ? "ligado" : "desligado",
+           (unsigned long)clock_trabalho_khz, (unsigned long)cfg.clock_sono_khz,
+           (unsigned long)(total / 1000u));
+    printf("  CPU acordada %lu.%lu%% | clock reduzido %lu.%lu%% | ADC ligado %lu.%lu%%\n",
+           (unsigned long)(cpu / 10), (unsigned long)(cpu % 10),
+           (unsigned long)(reduzido / 10), (unsigned long)(reduzido % 10),
+           (unsigned long)(adc / 10), (unsigned long)(adc % 10));
+    printf("  sonos %lu | trocas de clock %lu\n", (unsigned long)sonos, (unsigned long)trocas_clock);
+}
+
+void energia_zerar(void) {
+    inicio_medicao_us = time_us_64();
+    dormindo_us = 0;
+    clock_reduzido_us = 0;
+    adc_base_us = tarefa1_adc_ligado_us();
+    sonos = 0;
+    trocas_clock = 0;
+}
@@ -0,0 +1,74 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: energia.h
+ *  Projeto: TempCycleDMA
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Modo de economia de energia para operação em bateria.
+ *
+ *      No tempo ocioso do executor o núcleo 0 dorme em WFE
+ *      até o próximo quadro (qualquer IRQ ou evento acorda),
+ *      opcionalmente com o clk_sys reduzido enquanto dorme.
+ *      ADC e USB têm clock próprio (PLL USB) e não mudam; o
+ *      baud do I2C e o divisor do PIO do NeoPixel são
+ *      reaplicados a cada troca de clock.
+ *
+ *      Junto com a aquisição em rajada ('taxa_rajada_hz' em
+ *      'config_aquisicao_t') o ADC e o sensor passam quase
+ *      toda a janela desligados. O relatório mostra o ciclo
+ *      de trabalho medido de CPU, clock reduzido e ADC.
+ *
+ *      Compilado com TEMPCYCLE_ECONOMIA=1 os dois modos já
+ *      vêm ligados por padrão.
+ *
+ *
+ *  Data: 14/10/2026
+ * ------------------------------------------------------------
+ */
+
+#ifndef ENERGIA_H
+#define ENERGIA_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifndef TEMPCYCLE_ECONOMIA
+#define TEMPCYCLE_ECONOMIA 0
+#endif
+
+// Cada sono volta ao ocioso após no máximo este tempo (entrada USB, histórico)
+#define ENERGIA_SONO_MAX_US     50000u
+#define ENERGIA_SONO_MIN_US      1000u   // Abaixo disto não vale dormir
+#define ENERGIA_FOLGA_CLOCK_US   5000u   // Mínimo para trocar o clock (relock da PLL)
+#define ENERGIA_CLOCK_MIN_KHZ   48000u   // Abaixo disto o I2C a 400 kHz fica impreciso
+
+typedef struct {
+    bool     dormir_no_ocioso;   // WFE entre quadros em vez de girar no laço
+    uint32_t clock_sono_khz;     // clk_sys enquanto dorme (0 = não troca)
+} config_energia_t;
+
+#define CONFIG_ENERGIA_PADRAO { TEMPCYCLE_ECONOMIA, TEMPCYCLE_ECONOMIA ? ENERGIA_CLOCK_MIN_KHZ : 0u }
+
+/**
+ * @brief Aplica a configuração (clock de sono validado contra a PLL).
+ *
+ * Guarda o clk_sys corrente como o clock de trabalho.
+ */
+void energia_configurar(const config_energia_t *cfg);
+
+/**
+ * @brief Dorme até 'folga_us' (limitado a ENERGIA_SONO_MAX_US).
+ *
+ * Só deve ser chamada sem trabalho pendente no ocioso: DMA do OLED e da
+ * matriz concluídos e nada esperando a flash.
+ */
+void energia_dormir(uint32_t folga_us);
+
+/**
+ * @brief Imprime o ciclo de trabalho medido desde o último zerar.
+ */
+void energia_relatorio(void);
+
+void energia_zerar(void);
+
+#endif  // ENERGIA_H
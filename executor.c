@@ -0,0 +1,236 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: executor.c
+ *  Projeto: TempCycleDMA
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Executor cíclico com quadro maior e quadro menor.
+ *
+ *      O quadro maior é o MMC dos períodos das tarefas; ele é
+ *      dividido em quadros menores de EXECUTOR_QUADRO_MENOR_MS.
+ *      A tabela 'liberadas[q]' guarda, por quadro menor, a
+ *      máscara das tarefas que rodam nele, calculada uma única
+ *      vez a partir do período e da fase declarados.
+ *
+ *      As tarefas rodam no laço principal (contexto de thread),
+ *      nunca na IRQ do alarme: um refresh lento do OLED atrasa
+ *      no máximo o restante do próprio quadro e é contado como
+ *      estouro, sem empurrar a aquisição do próximo quadro.
+ *      Quadros perdidos por estouro são pulados e o executor
+ *      volta a se alinhar à grade original de tempo.
+ *
+ *      Tarefas com gatilho vêm depois de quem publica o tópico
+ *      na tabela: a versão nova é vista no mesmo quadro, e a
+ *      latência do dado até a saída é de um quadro, não a
+ *      soma das fases. Sem versão nova a tarefa não roda, mas
+ *      ainda dá a batida no supervisor (está em dia).
+ *
+ *  Relacionamento:
+ *      - Configurado e iniciado em 'main.c'; reconfigurado no
+ *        ocioso quando o console muda um período.
+ *      - Cada execução é registrada em 'instrumentacao.c' e na
+ *        telemetria com a duração e o atraso em relação ao
+ *        início do quadro.
+ *      - Cada tarefa é uma fonte do 'supervisor.c': marca o
+ *        início e bate ao terminar.
+ *
+ *  
+ *  Data: 14/10/2026
+ * ------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "executor.h"
+#include "instrumentacao.h"
+#include "telemetria.h"
+#include "supervisor.h"
+
+static tarefa_ciclica_t *tabela = NULL;
+static uint8_t n_tarefas = 0;
+static uint8_t n_quadros = 0;
+static uint8_t liberadas[EXECUTOR_MAX_QUADROS];   // Bit i → tarefa i
+static uint8_t fonte_supervisor[EXECUTOR_MAX_TAREFAS];
+static funcao_tarefa_t ocioso = NULL;
+static uint32_t estouros_quadro = 0;
+static uint32_t quadros_pulados = 0;
+static absolute_time_t proximo_quadro;         // Início do próximo quadro (válido no ocioso)
+
+static uint32_t mdc(uint32_t a, uint32_t b) {
+    while (b) {
+        uint32_t r = a % b;
+        a = b;
+        b = r;
+    }
+    return a;
+}
+
+bool executor_configurar(tarefa_ciclica_t *tarefas, uint8_t n) {
+    if (n == 0 || n > EXECUTOR_MAX_TAREFAS) return false;
+
+    uint32_t maior_ms = EXECUTOR_QUADRO_MENOR_MS;
+    for (uint8_t i = 0; i < n; i++) {
+        tarefa_ciclica_t *t = &tarefas[i];
+        if (t->periodo_ms == 0 || t->periodo_ms % EXECUTOR_QUADRO_MENOR_MS ||
+            t->fase_ms % EXECUTOR_QUADRO_MENOR_MS || t->fase_ms >= t->periodo_ms) {
+            printf("Executor: periodo/fase invalidos em '%s'\n", t->nome);
+            return false;
+        }
+        maior_ms = maior_ms / mdc(maior_ms, t->periodo_ms) * t->periodo_ms;
+        if (maior_ms / EXECUTOR_QUADRO_MENOR_MS > EXECUTOR_MAX_QUADROS) {
+            printf("Executor: quadro maior excede %d quadros\n", EXECUTOR_MAX_QUADROS);
+            return false;
+        }
+    }
+
+    tabela = tarefas;
+    n_tarefas = n;
+    n_quadros = maior_ms / EXECUTOR_QUADRO_MENOR_MS;
+
+    bool cabe = true;
+    for (uint8_t q = 0; q < n_quadros; q++) {
+        uint32_t inicio_ms = q * EXECUTOR_QUADRO_MENOR_MS;
+        uint32_t ocupacao_us = 0;
+        liberadas[q] = 0;
+
+        for (uint8_t i = 0; i < n; i++) {
+            tarefa_ciclica_t *t = &tarefas[i];
+            if (inicio_ms >= t->fase_ms && (inicio_ms - t->fase_ms) % t->periodo_ms == 0) {
+                liberadas[q] |= 1u << i;
+                ocupacao_us += t->orcamento_us;
+            }
+        }
+        if (ocupacao_us > EXECUTOR_QUADRO_MENOR_MS * 1000u) {
+            printf("Executor: quadro %u exige %lu us (> %u ms)\n",
+                   q, (unsigned long)ocupacao_us, EXECUTOR_QUADRO_MENOR_MS);
+            cabe = false;
+        }
+    }
+
+    for (uint8_t i = 0; i < n; i++) {
+        instr_nomear(i, tarefas[i].nome);
+        // Folga de um período inteiro mais um quadro para quadros pulados por estouro
+        fonte_supervisor[i] = supervisor_registrar(tarefas[i].nome,
+                                                   2 * tarefas[i].periodo_ms + EXECUTOR_QUADRO_MENOR_MS);
+        tarefas[i].versao_vista = tarefas[i].gatilho ? topico_versao(tarefas[i].gatilho) : 0;
+        tarefas[i].sem_dados = 0;
+        tarefas[i].execucoes = 0;
+        tarefas[i].estouros = 0;
+        tarefas[i].ultima_duracao_us = 0;
+        tarefas[i].max_duracao_us = 0;
+    }
+    return cabe;
+}
+
+void executor_definir_ocioso(funcao_tarefa_t funcao) {
+    ocioso = funcao;
+}
+
+/**
+ * @brief Roda uma tarefa medindo a duração contra o orçamento.
+ *
+ * @param i Índice da tarefa (também o ponto de instrumentação)
+ * @param liberacao Início nominal do quadro em que a tarefa foi liberada
+ */
+static void executar_tarefa(uint8_t i, absolute_time_t liberacao) {
+    tarefa_ciclica_t *t = &tabela[i];
+    if (t->gatilho) {
+        uint32_t v = topico_versao(t->gatilho);
+        if (v == t->versao_vista) {
+            t->sem_dados++;
+            supervisor_batida(fonte_supervisor[i]);
+            return;
+        }
+        t->versao_vista = v;   // Antes de rodar: publicação durante a execução não se perde
+    }
+
+    absolute_time_t ini = get_absolute_time();
+    supervisor_marcar(fonte_supervisor[i]);
+    t->funcao();
+    uint32_t dur = (uint32_t)absolute_time_diff_us(ini, get_absolute_time());
+    supervisor_batida(fonte_supervisor[i]);
+
+    uint32_t atraso = (uint32_t)absolute_time_diff_us(liberacao, ini);
+    instr_registrar(i, atraso, dur);
+    telemetria_registrar(TELEM_TAREFA, i, (int32_t)atraso, dur);
+
+    t->execucoes++;
+    t->ultima_duracao_us = dur;
+    if (dur > t->max_duracao_us) t->max_duracao_us = dur;
+    if (dur > t->orcamento_us) t->estouros++;
+}
+
+void executor_executar(void) {
+    uint8_t q = 0;
+    absolute_time_t inicio_quadro = get_absolute_time();
+
+    while (true) {
+        if (q >= n_quadros) q = 0;   // Reconfigurado no ocioso com um quadro maior menor
+        uint8_t mascara = liberadas[q];
+        for (uint8_t i = 0; i < n_tarefas; i++) {
+            if (mascara & (1u << i)) {
+                executar_tarefa(i, inicio_quadro);
+            }
+        }
+
+        absolute_time_t proximo = delayed_by_ms(inicio_quadro, EXECUTOR_QUADRO_MENOR_MS);
+        if (time_reached(proximo)) {
+            // Estouro: descarta os quadros já vencidos mantendo a grade
+            estouros_quadro++;
+            while (time_reached(delayed_by_ms(proximo, EXECUTOR_QUADRO_MENOR_MS))) {
+                proximo = delayed_by_ms(proximo, EXECUTOR_QUADRO_MENOR_MS);
+                q = (q + 1) % n_quadros;
+                quadros_pulados++;
+            }
+        }
+
+        proximo_quadro = proximo;
+        supervisor_marcar(SUPERVISOR_OCIOSO);
+        while (!time_reached(proximo)) {
+            if (ocioso) {
+                ocioso();
+            } else {
+                tight_loop_contents();
+            }
+        }
+
+        inicio_quadro = proximo;
+        q = (q + 1) % n_quadros;
+    }
+}
+
+void executor_relatorio(void) {
+    printf("Executor: %u quadros de %u ms | estouros de quadro: %lu | pulados: %lu\n",
+           n_quadros, EXECUTOR_QUADRO_MENOR_MS,
+           (unsigned long)estouros_quadro, (unsigned long)quadros_pulados);
+
+    for (uint8_t q = 0; q < n_quadros; q++) {
+        uint32_t ocupacao_us = 0;
+        for (uint8_t i = 0; i < n_tarefas; i++) {
+            if (liberadas[q] & (1u << i)) ocupacao_us += tabela[i].orcamento_us;
+        }
+        printf("  quadro %u: mascara 0x%02x, orcamento %lu us (%lu%%)\n", q, liberadas[q],
+               (unsigned long)ocupacao_us,
+               (unsigned long)(ocupacao_us / (EXECUTOR_QUADRO_MENOR_MS * 10u)));
+    }
+    for (uint8_t i = 0; i < n_tarefas; i++) {
+        const tarefa_ciclica_t *t = &tabela[i];
+        printf("  %-10s T=%lums F=%lums C=%luus | exec %lu, max %luus, estouros %lu",
+               t->nome, (unsigned long)t->periodo_ms, (unsigned long)t->fase_ms,
+               (unsigned long)t->orcamento_us, (unsigned long)t->execucoes,
+               (unsigned long)t->max_duracao_us, (unsigned long)t->estouros);
+        if (t->gatilho) {
+            printf(" | gatilho '%s', sem dados %lu", t->gatilho->nome, (unsigned long)t->sem_dados);
+        }
+        printf("\n");
+    }
+}
+
+uint32_t executor_estouros_quadro(void) {
+    return estouros_quadro;
+}
+
+uint32_t executor_folga_us(void) {
+    int64_t folga = absolute_time_diff_us(get_absolute_time(), proximo_quadro);
+    return folga > 0 ? (uint32_t)folga : 0;
+}
@@ -0,0 +1,93 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: executor.h
+ *  Projeto: TempCycleDMA
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Interface do executor cíclico com tabela de quadros
+ *      (quadro maior / quadro menor).
+ *
+ *      Cada tarefa declara período, fase e orçamento de tempo
+ *      (WCET). Na configuração o executor monta a tabela de
+ *      quadros, verifica se a soma dos orçamentos de cada
+ *      quadro menor cabe no quadro e, em execução, roda as
+ *      tarefas em contexto de thread a partir do laço
+ *      principal, contando estouros de orçamento e de quadro.
+ *
+ *      Uma tarefa com 'gatilho' é dirigida por dados: nos
+ *      quadros em que é liberada, só roda se o tópico tiver
+ *      versão nova desde a última execução dela.
+ *
+ *  
+ *  Data: 14/10/2026
+ * ------------------------------------------------------------
+ */
+
+#ifndef EXECUTOR_H
+#define EXECUTOR_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "topicos.h"
+
+#define EXECUTOR_QUADRO_MENOR_MS 500   // Duração de um quadro menor
+#define EXECUTOR_MAX_TAREFAS 8
+#define EXECUTOR_MAX_QUADROS 16        // Quadros menores por quadro maior
+
+typedef void (*funcao_tarefa_t)(void);
+
+// Tarefa periódica: os seis primeiros campos são declarados; os demais
+// são preenchidos pelo executor.
+typedef struct {
+    const char *nome;
+    funcao_tarefa_t funcao;
+    uint32_t periodo_ms;        // Múltiplo de EXECUTOR_QUADRO_MENOR_MS
+    uint32_t fase_ms;           // Deslocamento da 1ª liberação (< período)
+    uint32_t orcamento_us;      // Tempo máximo previsto por execução
+    const topico_t *gatilho;    // NULL = roda a cada liberação; senão só com versão nova
+
+    uint32_t versao_vista;      // Versão do gatilho na última execução
+    uint32_t sem_dados;         // Liberações puladas (gatilho sem versão nova)
+    uint32_t execucoes;
+    uint32_t estouros;          // Execuções acima do orçamento
+    uint32_t ultima_duracao_us;
+    uint32_t max_duracao_us;
+} tarefa_ciclica_t;
+
+/**
+ * @brief Monta a tabela de quadros e verifica se o escalonamento cabe.
+ *
+ * @param tarefas Vetor de tarefas (a ordem define a ordem no quadro)
+ * @param n Número de tarefas (≤ EXECUTOR_MAX_TAREFAS)
+ * @return true se todos os períodos/fases são válidos e cada quadro menor
+ *         comporta a soma dos orçamentos das suas tarefas
+ */
+bool executor_configurar(tarefa_ciclica_t *tarefas, uint8_t n);
+
+/**
+ * @brief Define uma função chamada repetidamente enquanto o executor
+ *        aguarda o próximo quadro (trabalho de baixa prioridade).
+ */
+void executor_definir_ocioso(funcao_tarefa_t funcao);
+
+/**
+ * @brief Executa a tabela de quadros indefinidamente (não retorna).
+ */
+void executor_executar(void);
+
+/**
+ * @brief Imprime a tabela de quadros, a ocupação prevista e os contadores.
+ */
+void executor_relatorio(void);
+
+/**
+ * @brief Quadros menores cujo trabalho ultrapassou o fim do quadro.
+ */
+uint32_t executor_estouros_quadro(void);
+
+/**
+ * @brief Tempo até o início do próximo quadro (µs); válido no ocioso.
+ */
+uint32_t executor_folga_us(void);
+
+#endif  // EXECUTOR_H
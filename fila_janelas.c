@@ -0,0 +1,57 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: fila_janelas.c
+ *  Projeto: TempCycleDMA
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Implementação da fila SPSC de janelas de aquisição.
+ *
+ *      'cabeca' só é escrita pelo produtor (núcleo 1) e 'cauda'
+ *      só pelo consumidor (núcleo 0). Os índices crescem sem
+ *      limite e são reduzidos pela máscara da capacidade, de
+ *      modo que cheio/vazio se distinguem sem posição extra.
+ *
+ *  
+ *  Data: 14/10/2026
+ * ------------------------------------------------------------
+ */
+
+#include "pico/stdlib.h"
+#include "fila_janelas.h"
+
+#define FILA_MASCARA (FILA_JANELAS_CAPACIDADE - 1u)
+
+static resultado_aquisicao_t itens[FILA_JANELAS_CAPACIDADE];
+static volatile uint32_t cabeca = 0;   // Próxima posição a escrever
+static volatile uint32_t cauda = 0;    // Próxima posição a ler
+static volatile uint32_t descartes = 0;
+
+bool fila_janelas_publicar(const resultado_aquisicao_t *j) {
+    uint32_t c = cabeca;
+    if (c - cauda >= FILA_JANELAS_CAPACIDADE) {
+        descartes++;
+        return false;
+    }
+
+    itens[c & FILA_MASCARA] = *j;
+    __dmb();            // Dado visível antes do novo índice
+    cabeca = c + 1;
+    return true;
+}
+
+bool fila_janelas_consumir(resultado_aquisicao_t *j) {
+    uint32_t t = cauda;
+    if (t == cabeca) {
+        return false;
+    }
+
+    __dmb();            // Lê o dado só depois de ver o índice
+    *j = itens[t & FILA_MASCARA];
+    __dmb();            // Cópia concluída antes de liberar a posição
+    cauda = t + 1;
+    return true;
+}
+
+uint32_t fila_janelas_descartes(void) {
+    return descartes;
+}
@@ -0,0 +1,51 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: fila_janelas.h
+ *  Projeto: TempCycleDMA
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Fila sem trava (lock-free) de um produtor e um
+ *      consumidor (SPSC) para entregar as janelas fechadas
+ *      pela aquisição no núcleo 1 às tarefas do núcleo 0.
+ *
+ *      Cada lado escreve apenas o seu índice; a ordem entre a
+ *      cópia do dado e a publicação do índice é garantida por
+ *      barreira de memória (__dmb), sem desabilitar IRQs nem
+ *      usar spinlocks.
+ *
+ *  
+ *  Data: 14/10/2026
+ * ------------------------------------------------------------
+ */
+
+#ifndef FILA_JANELAS_H
+#define FILA_JANELAS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "tarefa1_temp.h"
+
+#define FILA_JANELAS_CAPACIDADE 8   // Potência de 2
+
+/**
+ * @brief Publica uma janela (apenas o produtor chama).
+ *
+ * @param j Janela a copiar para a fila
+ * @return false se a fila estava cheia (janela descartada e contada)
+ */
+bool fila_janelas_publicar(const resultado_aquisicao_t *j);
+
+/**
+ * @brief Retira a janela mais antiga (apenas o consumidor chama).
+ *
+ * @param j Destino da cópia
+ * @return true se havia janela disponível
+ */
+bool fila_janelas_consumir(resultado_aquisicao_t *j);
+
+/**
+ * @brief Número de janelas descartadas por fila cheia.
+ */
+uint32_t fila_janelas_descartes(void);
+
+#endif  // FILA_JANELAS_H
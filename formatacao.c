@@ -0,0 +1,62 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: formatacao.c
+ *  Projeto: TempCycleDMA
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Conversão de ponto fixo para texto com inteiros de 32
+ *      bits: uma divisão por 10^k para o arredondamento e os
+ *      dígitos gerados de trás para frente.
+ *
+ *  Relacionamento:
+ *      - Temperatura grande do OLED ('display_utils.c')
+ *      - Testada contra o snprintf do host em
+ *        'host/teste_regressao.c'
+ *
+ *
+ *  Data: 14/10/2026
+ * ------------------------------------------------------------
+ */
+
+#include "formatacao.h"
+
+static const uint32_t potencias_10[] = {
+    1u, 10u, 100u, 1000u, 10000u, 100000u, 1000000u, 10000000u, 100000000u, 1000000000u
+};
+
+uint8_t formatar_fixo(char *dest, int32_t valor, uint8_t casas_valor, uint8_t casas, bool sinal) {
+    if (casas_valor > 9) casas_valor = 9;
+    if (casas > casas_valor) casas = casas_valor;
+
+    // Magnitude em 'casas' decimais, arredondada com o meio para longe do zero
+    bool negativo = valor < 0;
+    uint32_t mag = negativo ? 0u - (uint32_t)valor : (uint32_t)valor;
+    uint32_t div = potencias_10[casas_valor - casas];
+    uint32_t resto = mag % div;
+    mag /= div;
+    if (div > 1u && resto >= div / 2u) mag++;
+    if (mag == 0) negativo = false;
+
+    // Dígitos de trás para frente: casas decimais, ponto, parte inteira
+    char tmp[FORMATACAO_TAM_MAX];
+    uint8_t n = 0;
+    for (uint8_t i = 0; i < casas; i++) {
+        tmp[n++] = (char)('0' + mag % 10u);
+        mag /= 10u;
+    }
+    if (casas) tmp[n++] = '.';
+    do {
+        tmp[n++] = (char)('0' + mag % 10u);
+        mag /= 10u;
+    } while (mag);
+
+    uint8_t len = 0;
+    if (negativo) {
+        dest[len++] = '-';
+    } else if (sinal) {
+        dest[len++] = '+';
+    }
+    while (n) dest[len++] = tmp[--n];
+    dest[len] = '\0';
+    return len;
+}
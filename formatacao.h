@@ -0,0 +1,51 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: formatacao.h
+ *  Projeto: TempCycleDMA
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Formatação de números em ponto fixo, sem float e sem
+ *      printf: o resultado da aquisição (m°C, µV) vira texto
+ *      direto para o OLED, o console e os logs.
+ *
+ *      O arredondamento é para o mais próximo, com o meio
+ *      para longe do zero, e o sinal é fixo: um valor que
+ *      arredonda para zero sai "+0.0" (nunca "-0.0"), então
+ *      a largura do texto só muda com o número de dígitos.
+ *
+ *      Com o printf sem suporte a float (TEMPCYCLE_PRINTF_FLOAT
+ *      desligado, o padrão) este é o único caminho para casas
+ *      decimais.
+ *
+ *
+ *  Data: 14/10/2026
+ * ------------------------------------------------------------
+ */
+
+#ifndef FORMATACAO_H
+#define FORMATACAO_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Maior texto gerado: "-2147483.648" e o terminador
+#define FORMATACAO_TAM_MAX 13
+
+/**
+ * @brief Escreve um valor em ponto fixo decimal.
+ *
+ * @param dest Destino (pelo menos FORMATACAO_TAM_MAX bytes).
+ * @param valor Valor com 'casas_valor' casas implícitas (ex.: m°C → 3).
+ * @param casas_valor Casas decimais de 'valor' (0 a 9).
+ * @param casas Casas exibidas (≤ casas_valor), com arredondamento.
+ * @param sinal true sempre põe '+' ou '-'; false só o '-'.
+ * @return Comprimento do texto (sem o terminador).
+ */
+uint8_t formatar_fixo(char *dest, int32_t valor, uint8_t casas_valor, uint8_t casas, bool sinal);
+
+// Temperatura em m°C com 'casas' decimais (ex.: 25340, 1 → "25.3")
+static inline uint8_t formatar_mC(char *dest, int32_t mC, uint8_t casas, bool sinal) {
+    return formatar_fixo(dest, mC, 3, casas, sinal);
+}
+
+#endif  // FORMATACAO_H
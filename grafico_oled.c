@@ -0,0 +1,225 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: grafico_oled.c
+ *  Projeto: TempCycleDMA
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Implementação do gráfico de varredura do OLED.
+ *
+ *      A amostra de sequência 's' fica na coluna s % 128, e
+ *      'coluna_valor[]' guarda o valor de cada coluna: ele é
+ *      ao mesmo tempo o anel das amostras visíveis e a fonte
+ *      do redesenho. As filas de mínimo e máximo guardam as
+ *      sequências em ordem monotônica de valor; a frente de
+ *      cada uma é o extremo da janela visível.
+ *
+ *      As colunas alteradas ficam num mapa de bits e saem no
+ *      ocioso, uma sequência contígua por envio, pela janela
+ *      de endereçamento do SSD1306 (ssd1306_flush_janela) —
+ *      a cópia do painel continua em dia, então a Tarefa 2
+ *      não as reenvia.
+ *
+ *  Relacionamento:
+ *      - Amostras vindas da Tarefa 1 em 'main.c'
+ *      - Divide o framebuffer 'ssd' com 'tarefa2_display.c',
+ *        que não toca nas páginas do gráfico
+ *
+ *
+ *  Data: 14/10/2026
+ * ------------------------------------------------------------
+ */
+
+#include <string.h>
+#include "ssd1306.h"
+#include "grafico_oled.h"
+
+#define VAZIA INT32_MIN
+#define JANELA (GRAFICO_COLUNAS - 1)   // Amostras visíveis (uma coluna é o cursor)
+
+typedef struct {
+    uint32_t seq[GRAFICO_COLUNAS];
+    uint8_t ini, n;
+} fila_t;
+
+static uint8_t *fb = NULL;
+static int32_t coluna_valor[GRAFICO_COLUNAS];
+static uint32_t proxima_seq = 0;
+static fila_t fila_min, fila_max;
+static int32_t escala_min, escala_max;
+static bool escala_valida = false;
+static uint32_t sujas[GRAFICO_COLUNAS / 32];
+static uint32_t colunas_enviadas = 0, reescalas = 0;
+
+// === Filas monotônicas ===
+
+static inline int32_t valor_seq(uint32_t s) {
+    return coluna_valor[s % GRAFICO_COLUNAS];
+}
+
+static inline uint32_t fila_frente(const fila_t *f) {
+    return f->seq[f->ini];
+}
+
+static inline uint32_t fila_fundo(const fila_t *f) {
+    return f->seq[(f->ini + f->n - 1) % GRAFICO_COLUNAS];
+}
+
+/**
+ * @brief Insere 's' no fundo, descartando quem nunca mais será extremo.
+ *
+ * @param minimo true para a fila do mínimo (valores crescentes da frente
+ *               para o fundo), false para a do máximo
+ */
+static void fila_inserir(fila_t *f, uint32_t s, bool minimo) {
+    int32_t v = valor_seq(s);
+
+    while (f->n && fila_frente(f) + JANELA <= s) {
+        f->ini = (f->ini + 1) % GRAFICO_COLUNAS;
+        f->n--;
+    }
+    while (f->n && (minimo ? valor_seq(fila_fundo(f)) >= v : valor_seq(fila_fundo(f)) <= v)) {
+        f->n--;
+    }
+    f->seq[(f->ini + f->n) % GRAFICO_COLUNAS] = s;
+    f->n++;
+}
+
+// === Escala e desenho ===
+
+static int32_t arredondar_baixo(int32_t v) {
+    int32_t q = v / GRAFICO_PASSO_MC;
+    if (v % GRAFICO_PASSO_MC < 0) q--;
+    return q * GRAFICO_PASSO_MC;
+}
+
+static void escala_ideal(int32_t vmin, int32_t vmax, int32_t *lo, int32_t *hi) {
+    *lo = arredondar_baixo(vmin);
+    *hi = arredondar_baixo(vmax);
+    if (*hi < vmax) *hi += GRAFICO_PASSO_MC;
+    while (*hi - *lo < GRAFICO_FAIXA_MIN_MC) {
+        *hi += GRAFICO_PASSO_MC;
+        if (*hi - *lo < GRAFICO_FAIXA_MIN_MC) *lo -= GRAFICO_PASSO_MC;
+    }
+}
+
+// Linha do pixel (0 = topo do gráfico)
+static int linha(int32_t v) {
+    int32_t y = (GRAFICO_ALTURA - 1) -
+                (int32_t)((int64_t)(v - escala_min) * (GRAFICO_ALTURA - 1) / (escala_max - escala_min));
+    if (y < 0) y = 0;
+    if (y > GRAFICO_ALTURA - 1) y = GRAFICO_ALTURA - 1;
+    return y;
+}
+
+// Segmento vertical do valor anterior até o da coluna (linha contínua)
+static void desenhar_coluna(uint col) {
+    uint32_t mascara = 0;
+    int32_t v = coluna_valor[col];
+
+    if (v != VAZIA) {
+        int32_t ant = coluna_valor[(col + GRAFICO_COLUNAS - 1) % GRAFICO_COLUNAS];
+        int a = linha(v);
+        int b = ant != VAZIA ? linha(ant) : a;
+        if (a > b) {
+            int t = a;
+            a = b;
+            b = t;
+        }
+        mascara = (uint32_t)((2u << b) - (1u << a));
+    }
+    for (int p = 0; p < GRAFICO_PAGINAS; p++) {
+        fb[(GRAFICO_PAGINA_INI + p) * ssd1306_width + col] = (uint8_t)(mascara >> (8 * p));
+    }
+}
+
+static inline void marcar(uint col) {
+    sujas[col / 32] |= 1u << (col % 32);
+}
+
+// === API ===
+
+void grafico_iniciar(uint8_t *ssd) {
+    fb = ssd;
+    for (uint c = 0; c < GRAFICO_COLUNAS; c++) coluna_valor[c] = VAZIA;
+    proxima_seq = 0;
+    fila_min.n = fila_max.n = 0;
+    escala_valida = false;
+    memset(fb + GRAFICO_PAGINA_INI * ssd1306_width, 0, GRAFICO_PAGINAS * ssd1306_width);
+    memset(sujas, 0xFF, sizeof(sujas));
+}
+
+void grafico_adicionar(int32_t temp_mC) {
+    if (!fb) return;
+
+    uint32_t s = proxima_seq++;
+    uint col = s % GRAFICO_COLUNAS;
+    uint cursor = (col + 1) % GRAFICO_COLUNAS;
+    coluna_valor[col] = temp_mC;
+    coluna_valor[cursor] = VAZIA;   // Amostra s − 127, que acabou de sair da janela
+
+    fila_inserir(&fila_min, s, true);
+    fila_inserir(&fila_max, s, false);
+    int32_t vmin = valor_seq(fila_frente(&fila_min));
+    int32_t vmax = valor_seq(fila_frente(&fila_max));
+
+    int32_t lo, hi;
+    escala_ideal(vmin, vmax, &lo, &hi);
+    bool reescalar = !escala_valida || vmin < escala_min || vmax > escala_max ||
+                     2 * (hi - lo) <= escala_max - escala_min;
+
+    if (reescalar) {
+        escala_min = lo;
+        escala_max = hi;
+        escala_valida = true;
+        reescalas++;
+        for (uint c = 0; c < GRAFICO_COLUNAS; c++) desenhar_coluna(c);
+        memset(sujas, 0xFF, sizeof(sujas));
+    } else {
+        desenhar_coluna(col);
+        desenhar_coluna(cursor);
+        marcar(col);
+        marcar(cursor);
+    }
+}
+
+void grafico_poll(void) {
+    if (!fb || ssd1306_flush_ocupado()) return;
+
+    int a = -1, b = -1;
+    for (int c = 0; c < GRAFICO_COLUNAS; c++) {
+        bool suja = sujas[c / 32] & (1u << (c % 32));
+        if (suja && a < 0) a = c;
+        if (!suja && a >= 0) break;
+        if (suja) b = c;
+    }
+    if (a < 0) return;
+
+    struct render_area janela = {
+        .start_column = (uint8_t)a,
+        .end_column = (uint8_t)b,
+        .start_page = GRAFICO_PAGINA_INI,
+        .end_page = GRAFICO_PAGINA_INI + GRAFICO_PAGINAS - 1,
+    };
+    calculate_render_area_buffer_length(&janela);
+    if (!ssd1306_flush_janela(fb, &janela, NULL)) return;
+
+    for (int c = a; c <= b; c++) sujas[c / 32] &= ~(1u << (c % 32));
+    colunas_enviadas += (uint32_t)(b - a + 1);
+}
+
+bool grafico_pendente(void) {
+    for (uint i = 0; i < GRAFICO_COLUNAS / 32; i++) {
+        if (sujas[i]) return fb != NULL;
+    }
+    return false;
+}
+
+void grafico_escala(int32_t *min_mC, int32_t *max_mC) {
+    *min_mC = escala_min;
+    *max_mC = escala_max;
+}
+
+void grafico_estatisticas(uint32_t *enviadas, uint32_t *n_reescalas) {
+    *enviadas = colunas_enviadas;
+    *n_reescalas = reescalas;
+}
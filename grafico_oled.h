@@ -0,0 +1,68 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: grafico_oled.h
+ *  Projeto: TempCycleDMA
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Gráfico de varredura (strip chart) das médias de janela
+ *      nas páginas 1–3 do OLED (128 × 24 px).
+ *
+ *      Cada amostra ocupa a coluna seguinte à anterior, como
+ *      num monitor de ECG: a coluna nova é desenhada e a
+ *      próxima é apagada (cursor), e só essas duas colunas
+ *      vão ao painel. O quadro nunca é redesenhado inteiro,
+ *      exceto quando a escala muda.
+ *
+ *      A escala acompanha o mínimo e o máximo das amostras
+ *      visíveis, mantidos por duas filas monotônicas (O(1)
+ *      amortizado por amostra), arredondados para passos de
+ *      GRAFICO_PASSO_MC e com faixa mínima de
+ *      GRAFICO_FAIXA_MIN_MC para o ruído não virar serrilhado.
+ *      Ela só muda quando uma amostra sai da faixa ou quando
+ *      a escala ideal caberia na metade da atual.
+ *
+ *
+ *  Data: 14/10/2026
+ * ------------------------------------------------------------
+ */
+
+#ifndef GRAFICO_OLED_H
+#define GRAFICO_OLED_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define GRAFICO_PAGINA_INI 1
+#define GRAFICO_PAGINAS    3
+#define GRAFICO_ALTURA     (GRAFICO_PAGINAS * 8)
+#define GRAFICO_COLUNAS    128
+#define GRAFICO_PASSO_MC     500    // Escala em múltiplos de 0,5 °C
+#define GRAFICO_FAIXA_MIN_MC 1000   // Pelo menos 1 °C de altura
+
+/**
+ * @brief Limpa o histórico do gráfico e a área dele no framebuffer.
+ *
+ * @param ssd Framebuffer completo do OLED (o mesmo da Tarefa 2)
+ */
+void grafico_iniciar(uint8_t *ssd);
+
+/**
+ * @brief Acrescenta uma amostra: desenha a coluna e marca para envio.
+ */
+void grafico_adicionar(int32_t temp_mC);
+
+/**
+ * @brief Envia as colunas pendentes quando o barramento está livre
+ *        (chamar no tempo ocioso).
+ */
+void grafico_poll(void);
+
+/**
+ * @brief true enquanto houver colunas desenhadas e ainda não enviadas.
+ */
+bool grafico_pendente(void);
+
+void grafico_escala(int32_t *min_mC, int32_t *max_mC);
+void grafico_estatisticas(uint32_t *colunas_enviadas, uint32_t *reescalas);
+
+#endif  // GRAFICO_OLED_H
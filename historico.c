@@ -0,0 +1,375 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: historico.c
+ *  Projeto: TempCycleDMA
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Implementação do histórico em flash.
+ *
+ *      Formato de um setor (4 KB):
+ *          cabeçalho (28 B) | registros em delta | 0xFF...
+ *      O cabeçalho traz a sequência global do setor, o boot,
+ *      o primeiro registro em valor absoluto, a contagem e o
+ *      FNV-1a dos bytes de registros. Cada registro seguinte é
+ *      varint(zigzag(Δtemp_mC)) + varint(Δt_ms): 3 bytes num
+ *      caso típico (Δt = 2000 ms), ~1350 registros por setor.
+ *
+ *      O setor de sequência 's' fica na posição s % N da
+ *      região. Na volta mais recente as posições 0..k têm
+ *      seq = s0 + posição e as demais são da volta anterior
+ *      (ou estão apagadas), o que permite a busca binária.
+ *
+ *      As páginas de dados são gravadas antes e o cabeçalho
+ *      por último: um setor interrompido no meio não tem
+ *      cabeçalho válido e é ignorado no boot.
+ *
+ *  Relacionamento:
+ *      - Registros vindos da Tarefa 1 em 'main.c'
+ *      - Serviço chamado pelo laço ocioso do executor
+ *
+ *
+ *  Data: 14/10/2026
+ * ------------------------------------------------------------
+ */
+
+#include <string.h>
+#include "pico/stdlib.h"
+#include "pico/flash.h"
+#include "hardware/flash.h"
+#include "historico.h"
+
+#define HISTORICO_MAGICA 0x31484354u   // "TCH1"
+#define HISTORICO_OFFSET (PICO_FLASH_SIZE_BYTES - HISTORICO_SETORES * FLASH_SECTOR_SIZE)
+#define REGISTRO_MAX_BYTES 10u         // Dois varints de 32 bits
+#define TRAVA_TIMEOUT_MS 10u           // Espera pelo núcleo 1 sair da flash
+
+typedef struct {
+    uint32_t magica;
+    uint32_t seq;
+    uint16_t boot;
+    uint16_t n_registros;
+    uint16_t bytes;             // Bytes de registros após o cabeçalho
+    uint16_t reservado;
+    int32_t  temp0_mC;          // Primeiro registro, em valor absoluto
+    uint32_t t0_ms;
+    uint32_t hash;              // FNV-1a dos bytes de registros
+} cabecalho_setor_t;
+
+#define CAPACIDADE (FLASH_SECTOR_SIZE - sizeof(cabecalho_setor_t))
+
+typedef struct {
+    cabecalho_setor_t cab;
+    uint8_t dados[CAPACIDADE];
+} setor_t;
+
+_Static_assert(sizeof(setor_t) == FLASH_SECTOR_SIZE, "setor_t precisa ocupar um setor");
+_Static_assert(HISTORICO_SETORES >= 2, "historico precisa de ao menos dois setores");
+
+// Dois setores em RAM: um em montagem e, se 'pronto' ≥ 0, outro esperando a flash
+static setor_t buffers[2];
+_Static_assert(sizeof(buffers) == HISTORICO_RAM_BYTES, "HISTORICO_RAM_BYTES desatualizado");
+static int montando = 0;
+static int pronto = -1;
+static int32_t ultimo_temp;     // Último registro do setor em montagem (base do delta)
+static uint32_t ultimo_t;
+
+static int64_t soma_janelas;
+static uint32_t n_janelas;
+
+typedef enum { ETAPA_APAGAR, ETAPA_PAGINAS } etapa_t;
+static etapa_t etapa;
+static uint8_t pagina;          // Próxima página a gravar; a 0 (cabeçalho) é a última
+
+static bool ativo = false;
+static uint16_t boot;
+static uint32_t seq_proximo;    // Sequência do próximo setor a fechar
+static uint32_t seq_fim;        // 1 + sequência do setor mais novo já na flash
+static uint32_t setores_gravados, registros_perdidos, falhas_flash, leituras_indice;
+
+static const setor_t *setor_flash(uint32_t posicao) {
+    return (const setor_t *)(uintptr_t)(XIP_BASE + HISTORICO_OFFSET + posicao * FLASH_SECTOR_SIZE);
+}
+
+static uint32_t fnv1a(const uint8_t *p, uint32_t n) {
+    uint32_t h = 2166136261u;
+    for (uint32_t i = 0; i < n; i++) h = (h ^ p[i]) * 16777619u;
+    return h;
+}
+
+static inline uint32_t zigzag(int32_t v) {
+    return ((uint32_t)v << 1) ^ (uint32_t)(v >> 31);
+}
+
+static inline int32_t dezigzag(uint32_t u) {
+    return (int32_t)(u >> 1) ^ -(int32_t)(u & 1u);
+}
+
+static uint32_t varint_escrever(uint8_t *p, uint32_t v) {
+    uint32_t n = 0;
+    while (v >= 0x80) {
+        p[n++] = (uint8_t)(v | 0x80);
+        v >>= 7;
+    }
+    p[n++] = (uint8_t)v;
+    return n;
+}
+
+static const uint8_t *varint_ler(const uint8_t *p, const uint8_t *fim, uint32_t *v) {
+    uint32_t r = 0;
+    for (int desloc = 0; p < fim && desloc < 35; desloc += 7) {
+        uint8_t b = *p++;
+        r |= (uint32_t)(b & 0x7F) << desloc;
+        if (!(b & 0x80)) {
+            *v = r;
+            return p;
+        }
+    }
+    return NULL;
+}
+
+static void limpar(setor_t *b) {
+    memset(b, 0xFF, sizeof(*b));
+    b->cab.boot = boot;
+    b->cab.n_registros = 0;
+    b->cab.bytes = 0;
+}
+
+// === Índice ===
+
+// Cabeçalho plausível na posição (magica e sequência da posição certa)
+static bool ler_cabecalho(uint32_t posicao, uint32_t *seq) {
+    const cabecalho_setor_t *c = &setor_flash(posicao)->cab;
+    leituras_indice++;
+    if (c->magica != HISTORICO_MAGICA || c->seq % HISTORICO_SETORES != posicao) return false;
+    *seq = c->seq;
+    return true;
+}
+
+// Sequência do setor mais novo: O(log N) leituras de cabeçalho
+static bool achar_mais_recente(uint32_t *seq) {
+    uint32_t s0, s;
+
+    if (!ler_cabecalho(0, &s0)) {
+        // Posição 0 apagada com a última ocupada: a volta parou logo antes de regravar a 0
+        return ler_cabecalho(HISTORICO_SETORES - 1, seq);
+    }
+
+    uint32_t lo = 0, hi = HISTORICO_SETORES;
+    while (hi - lo > 1) {
+        uint32_t meio = lo + (hi - lo) / 2;
+        if (ler_cabecalho(meio, &s) && s == s0 + meio) {
+            lo = meio;
+        } else {
+            hi = meio;
+        }
+    }
+    *seq = s0 + lo;
+    return true;
+}
+
+void historico_iniciar(void) {
+    ativo = false;
+    montando = 0;
+    pronto = -1;
+    soma_janelas = 0;
+    n_janelas = 0;
+    setores_gravados = registros_perdidos = falhas_flash = leituras_indice = 0;
+
+#if PICO_ON_DEVICE
+    // A região reservada não pode alcançar o fim do programa gravado
+    extern char __flash_binary_end;
+    if ((uintptr_t)&__flash_binary_end - XIP_BASE > HISTORICO_OFFSET) return;
+#endif
+
+    uint32_t seq;
+    if (achar_mais_recente(&seq)) {
+        seq_fim = seq + 1;
+        boot = (uint16_t)(setor_flash(seq % HISTORICO_SETORES)->cab.boot + 1);
+    } else {
+        seq_fim = 0;
+        boot = 0;
+    }
+    seq_proximo = seq_fim;
+
+    limpar(&buffers[montando]);
+    ativo = true;
+}
+
+// === Registro (RAM) ===
+
+// Passa o setor em montagem para a fila da flash
+static bool fechar(void) {
+    if (pronto >= 0) return false;
+
+    setor_t *b = &buffers[montando];
+    if (b->cab.n_registros == 0) return true;
+
+    b->cab.magica = HISTORICO_MAGICA;
+    b->cab.seq = seq_proximo++;
+    b->cab.hash = fnv1a(b->dados, b->cab.bytes);
+
+    pronto = montando;
+    etapa = ETAPA_APAGAR;
+    montando ^= 1;
+    limpar(&buffers[montando]);
+    return true;
+}
+
+static void acrescentar(int32_t temp_mC, uint32_t t_ms) {
+    setor_t *b = &buffers[montando];
+
+    if (b->cab.n_registros > 0 && b->cab.bytes + REGISTRO_MAX_BYTES > CAPACIDADE) {
+        if (!fechar()) {
+            registros_perdidos++;
+            return;
+        }
+        b = &buffers[montando];
+    }
+
+    if (b->cab.n_registros == 0) {
+        b->cab.temp0_mC = temp_mC;
+        b->cab.t0_ms = t_ms;
+    } else {
+        uint8_t *p = &b->dados[b->cab.bytes];
+        uint32_t n = varint_escrever(p, zigzag(temp_mC - ultimo_temp));
+        n += varint_escrever(p + n, t_ms - ultimo_t);
+        b->cab.bytes += n;
+    }
+    b->cab.n_registros++;
+    ultimo_temp = temp_mC;
+    ultimo_t = t_ms;
+}
+
+void historico_registrar(int32_t temp_mC, uint32_t timestamp_ms) {
+    if (!ativo) return;
+
+    soma_janelas += temp_mC;
+    if (++n_janelas < HISTORICO_JANELAS_POR_REGISTRO) return;
+
+    int64_t meia = n_janelas / 2;
+    int32_t media = (int32_t)((soma_janelas >= 0 ? soma_janelas + meia : soma_janelas - meia) / n_janelas);
+    soma_janelas = 0;
+    n_janelas = 0;
+    acrescentar(media, timestamp_ms);
+}
+
+bool historico_descarregar(void) {
+    return ativo && fechar();
+}
+
+// === Flash ===
+
+typedef struct {
+    bool apagar;
+    uint32_t offset;
+    const uint8_t *dados;
+} operacao_flash_t;
+
+// Roda com IRQs desligadas e o outro núcleo fora da flash
+static void executar_operacao(void *param) {
+    const operacao_flash_t *op = param;
+    if (op->apagar) {
+        flash_range_erase(op->offset, FLASH_SECTOR_SIZE);
+    } else {
+        flash_range_program(op->offset, op->dados, FLASH_PAGE_SIZE);
+    }
+}
+
+void historico_servico(uint32_t folga_us) {
+    if (!ativo || pronto < 0) return;
+
+    const setor_t *b = &buffers[pronto];
+    operacao_flash_t op = {
+        .apagar = (etapa == ETAPA_APAGAR),
+        .offset = HISTORICO_OFFSET + (b->cab.seq % HISTORICO_SETORES) * FLASH_SECTOR_SIZE,
+    };
+
+    if (op.apagar) {
+        if (folga_us < HISTORICO_FOLGA_APAGAR_US) return;
+    } else {
+        if (folga_us < HISTORICO_FOLGA_PAGINA_US) return;
+
+        // Páginas só com 0xFF já estão como o apagamento deixou
+        uint32_t usadas = (sizeof(cabecalho_setor_t) + b->cab.bytes + FLASH_PAGE_SIZE - 1) / FLASH_PAGE_SIZE;
+        if (pagina >= usadas) pagina = 0;
+        op.offset += pagina * FLASH_PAGE_SIZE;
+        op.dados = (const uint8_t *)b + pagina * FLASH_PAGE_SIZE;
+    }
+
+    if (flash_safe_execute(executar_operacao, &op, TRAVA_TIMEOUT_MS) != PICO_OK) {
+        falhas_flash++;
+        return;
+    }
+
+    if (op.apagar) {
+        etapa = ETAPA_PAGINAS;
+        pagina = 1;
+    } else if (pagina == 0) {
+        seq_fim = b->cab.seq + 1;
+        setores_gravados++;
+        pronto = -1;
+    } else {
+        pagina++;
+    }
+}
+
+bool historico_pendente(void) {
+    return ativo && pronto >= 0;
+}
+
+// === Leitura ===
+
+static uint32_t decodificar(const setor_t *b, historico_visitante_t fn, void *ctx, bool *parar) {
+    if (b->cab.n_registros == 0) return 0;
+
+    registro_historico_t r = { b->cab.temp0_mC, b->cab.t0_ms, b->cab.boot };
+    const uint8_t *p = b->dados, *fim = b->dados + b->cab.bytes;
+    uint32_t entregues = 0;
+
+    for (uint16_t i = 0; ; ) {
+        entregues++;
+        if (!fn(&r, ctx)) {
+            *parar = true;
+            break;
+        }
+        if (++i >= b->cab.n_registros) break;
+
+        uint32_t dtemp, dt;
+        if (!(p = varint_ler(p, fim, &dtemp)) || !(p = varint_ler(p, fim, &dt))) break;
+        r.temp_mC += dezigzag(dtemp);
+        r.timestamp_ms += dt;
+    }
+    return entregues;
+}
+
+uint32_t historico_percorrer(uint32_t setores, historico_visitante_t fn, void *ctx) {
+    if (!ativo) return 0;
+
+    uint32_t disponiveis = seq_fim < HISTORICO_SETORES ? seq_fim : HISTORICO_SETORES;
+    if (setores == 0 || setores > disponiveis) setores = disponiveis;
+
+    uint32_t total = 0;
+    bool parar = false;
+    for (uint32_t s = seq_fim - setores; s < seq_fim && !parar; s++) {
+        const setor_t *f = setor_flash(s % HISTORICO_SETORES);
+        if (f->cab.magica != HISTORICO_MAGICA || f->cab.seq != s ||
+            f->cab.bytes > CAPACIDADE || fnv1a(f->dados, f->cab.bytes) != f->cab.hash) {
+            continue;   // Em regravação, interrompido ou corrompido
+        }
+        total += decodificar(f, fn, ctx, &parar);
+    }
+
+    if (!parar && pronto >= 0) total += decodificar(&buffers[pronto], fn, ctx, &parar);
+    if (!parar) total += decodificar(&buffers[montando], fn, ctx, &parar);
+    return total;
+}
+
+void historico_estatisticas(estatisticas_historico_t *e) {
+    e->setores_gravados = setores_gravados;
+    e->registros_perdidos = registros_perdidos;
+    e->falhas_flash = falhas_flash;
+    e->leituras_indice = leituras_indice;
+    e->seq_proximo = seq_proximo;
+    e->boot = boot;
+    e->ativo = ativo;
+}
@@ -0,0 +1,115 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: historico.h
+ *  Projeto: TempCycleDMA
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Histórico persistente de temperatura numa região
+ *      reservada no fim da flash.
+ *
+ *      As médias das janelas são agrupadas em RAM e gravadas
+ *      em setores inteiros de 4 KB, com registros em delta
+ *      (zigzag + varint). Os setores são usados em rodízio,
+ *      o que distribui o desgaste por toda a região; a
+ *      sequência no cabeçalho de cada setor permite achar o
+ *      mais recente no boot por busca binária.
+ *
+ *      Apagar e gravar acontecem no tempo ocioso do executor,
+ *      em passos curtos (um apagamento ou uma página de 256 B
+ *      por chamada), só quando a folga informada comporta a
+ *      operação. Cada passo roda em 'flash_safe_execute', que
+ *      desliga as IRQs e, com TEMPCYCLE_DUAL_CORE, segura o
+ *      núcleo 1 fora da flash enquanto o XIP está parado.
+ *
+ *
+ *  Data: 14/10/2026
+ * ------------------------------------------------------------
+ */
+
+#ifndef HISTORICO_H
+#define HISTORICO_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Setores de 4 KB reservados no fim da flash (512 KB ≈ 4 dias a 1 registro / 2 s)
+#ifndef HISTORICO_SETORES
+#define HISTORICO_SETORES 128u
+#endif
+
+// RAM dos dois setores em montagem / esperando a flash
+#define HISTORICO_RAM_BYTES (2u * 4096u)
+
+// Médias de janela agregadas em cada registro (4 × 0,5 s = 2 s)
+#ifndef HISTORICO_JANELAS_POR_REGISTRO
+#define HISTORICO_JANELAS_POR_REGISTRO 4u
+#endif
+
+// Folga mínima para cada passo (apagar 4 KB leva ~45 ms típico; uma página, < 1 ms)
+#define HISTORICO_FOLGA_APAGAR_US 120000u
+#define HISTORICO_FOLGA_PAGINA_US   3000u
+
+typedef struct {
+    int32_t  temp_mC;
+    uint32_t timestamp_ms;      // ms desde o boot em que o registro foi feito
+    uint16_t boot;              // Contador de boots (muda a base do timestamp)
+} registro_historico_t;
+
+typedef struct {
+    uint32_t setores_gravados;  // Desde o boot
+    uint32_t registros_perdidos; // Buffers em RAM cheios antes de a flash liberar
+    uint32_t falhas_flash;      // flash_safe_execute recusado (tenta de novo depois)
+    uint32_t leituras_indice;   // Cabeçalhos lidos para achar o setor mais recente
+    uint32_t seq_proximo;       // Sequência do próximo setor a gravar
+    uint16_t boot;
+    bool     ativo;             // false se a região invade o programa
+} estatisticas_historico_t;
+
+/**
+ * @brief Acha o setor mais recente e prepara o buffer em RAM.
+ *
+ * Lê apenas cabeçalhos (busca binária pela sequência), sem apagar nada.
+ */
+void historico_iniciar(void);
+
+/**
+ * @brief Acrescenta a média de uma janela (custo constante, só RAM).
+ *
+ * A cada HISTORICO_JANELAS_POR_REGISTRO chamadas a média delas vira um
+ * registro.
+ */
+void historico_registrar(int32_t temp_mC, uint32_t timestamp_ms);
+
+/**
+ * @brief Avança a gravação pendente (chamar no tempo ocioso).
+ *
+ * @param folga_us Tempo livre garantido até a próxima atividade que não
+ *                 pode atrasar (quadro do executor, bloco do ADC)
+ */
+void historico_servico(uint32_t folga_us);
+
+/**
+ * @brief Fecha o setor em montagem para gravação mesmo incompleto.
+ *
+ * @return false se já havia um setor esperando a flash
+ */
+bool historico_descarregar(void);
+
+// Há setor esperando a flash (o ocioso não deve dormir)
+bool historico_pendente(void);
+
+// Recebe os registros em ordem cronológica; devolver false interrompe
+typedef bool (*historico_visitante_t)(const registro_historico_t *r, void *ctx);
+
+/**
+ * @brief Percorre o histórico, do mais antigo ao mais novo.
+ *
+ * @param setores Quantos setores gravados mais recentes visitar (0 = todos);
+ *                os registros ainda em RAM vêm no fim
+ * @return registros entregues
+ */
+uint32_t historico_percorrer(uint32_t setores, historico_visitante_t fn, void *ctx);
+
+void historico_estatisticas(estatisticas_historico_t *e);
+
+#endif  // HISTORICO_H
@@ -0,0 +1,22 @@
+// Mock do ADC: as conversões vêm de um fluxo gravado carregado com mock_adc_carregar()
+#ifndef MOCK_HARDWARE_ADC_H
+#define MOCK_HARDWARE_ADC_H
+
+#include "pico.h"
+
+typedef struct {
+    volatile uint32_t cs, result, fcs, fifo, div;
+} adc_hw_t;
+
+extern adc_hw_t *const adc_hw;
+
+void adc_init(void);
+void adc_select_input(uint entrada);
+void adc_set_temp_sensor_enabled(bool ligado);
+void adc_set_clkdiv(float div);
+void adc_fifo_setup(bool en, bool dreq_en, uint16_t dreq_thresh, bool err_in_fifo, bool byte_shift);
+void adc_fifo_drain(void);
+void adc_run(bool rodar);
+uint16_t adc_read(void);
+
+#endif
@@ -0,0 +1,11 @@
+// Mock de hardware/clocks.h: clk_sys fixo no padrão do SDK
+#ifndef MOCK_HARDWARE_CLOCKS_H
+#define MOCK_HARDWARE_CLOCKS_H
+
+#include "pico.h"
+
+enum clock_index { clk_ref = 4, clk_sys = 5, clk_peri = 6, clk_usb = 7, clk_adc = 8 };
+
+uint32_t clock_get_hz(enum clock_index clk_index);
+
+#endif
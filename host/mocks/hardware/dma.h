@@ -0,0 +1,43 @@
+// Mock do DMA: a transferência acontece inteira dentro de dma_channel_configure() quando
+// disparada. Leituras do FIFO do ADC e escritas no IC_DATA_CMD ou no FIFO TX do PIO
+// passam pelos mocks desses periféricos (ver mock_hw.h).
+#ifndef MOCK_HARDWARE_DMA_H
+#define MOCK_HARDWARE_DMA_H
+
+#include "pico.h"
+
+#define NUM_DMA_CHANNELS 12
+
+enum dma_channel_transfer_size { DMA_SIZE_8 = 0, DMA_SIZE_16 = 1, DMA_SIZE_32 = 2 };
+
+typedef struct {
+    enum dma_channel_transfer_size tamanho;
+    bool incr_leitura;
+    bool incr_escrita;
+    uint dreq;
+} dma_channel_config;
+
+#define DREQ_PIO0_TX0  0
+#define DREQ_I2C0_TX  32
+#define DREQ_I2C0_RX  33
+#define DREQ_I2C1_TX  34
+#define DREQ_I2C1_RX  35
+#define DREQ_ADC      36
+
+dma_channel_config dma_channel_get_default_config(uint canal);
+void channel_config_set_transfer_data_size(dma_channel_config *c, enum dma_channel_transfer_size t);
+void channel_config_set_read_increment(dma_channel_config *c, bool incr);
+void channel_config_set_write_increment(dma_channel_config *c, bool incr);
+void channel_config_set_dreq(dma_channel_config *c, uint dreq);
+
+void dma_channel_configure(uint canal, const dma_channel_config *c, volatile void *destino,
+                           const volatile void *origem, uint n, bool disparar);
+bool dma_channel_is_busy(uint canal);
+void dma_channel_wait_for_finish_blocking(uint canal);
+void dma_channel_abort(uint canal);
+
+void dma_channel_claim(uint canal);
+void dma_channel_unclaim(uint canal);
+int dma_claim_unused_channel(bool obrigatorio);
+
+#endif
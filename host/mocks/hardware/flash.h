@@ -0,0 +1,17 @@
+// Mock da flash: um vetor em RAM no lugar do XIP, com as regras da NOR
+// (apagar deixa 0xFF; gravar só leva bits de 1 para 0)
+#ifndef MOCK_HARDWARE_FLASH_H
+#define MOCK_HARDWARE_FLASH_H
+
+#include "pico.h"
+
+#define FLASH_PAGE_SIZE   256u
+#define FLASH_SECTOR_SIZE 4096u
+
+extern uint8_t mock_flash[PICO_FLASH_SIZE_BYTES];
+#define XIP_BASE ((uintptr_t)mock_flash)
+
+void flash_range_erase(uint32_t offset, size_t n);
+void flash_range_program(uint32_t offset, const uint8_t *dados, size_t n);
+
+#endif
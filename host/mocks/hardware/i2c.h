@@ -0,0 +1,42 @@
+// Mock do i2c: i2c_write_blocking() e as palavras vindas do DMA ficam num registro
+// consultado pelos testes (mock_i2c_palavras); o DMA RX lê as respostas de mock_i2c_responder
+#ifndef MOCK_HARDWARE_I2C_H
+#define MOCK_HARDWARE_I2C_H
+
+#include "pico.h"
+
+typedef struct {
+    volatile uint32_t con, tar;
+    volatile uint32_t data_cmd;
+    volatile uint32_t intr_stat, intr_mask, raw_intr_stat;
+    volatile uint32_t clr_tx_abrt, clr_stop_det;
+    volatile uint32_t enable, status;
+    volatile uint32_t tx_abrt_source;
+    volatile uint32_t dma_cr;
+} i2c_hw_t;
+
+typedef struct i2c_inst {
+    i2c_hw_t *hw;
+} i2c_inst_t;
+
+extern i2c_inst_t i2c0_inst, i2c1_inst;
+#define i2c0 (&i2c0_inst)
+#define i2c1 (&i2c1_inst)
+
+#define I2C_IC_DATA_CMD_STOP_BITS     _u(0x00000200)
+#define I2C_IC_DATA_CMD_RESTART_BITS  _u(0x00000400)
+#define I2C_IC_DATA_CMD_CMD_BITS      _u(0x00000100)
+#define I2C_IC_STATUS_ACTIVITY_BITS   _u(0x00000001)
+#define I2C_IC_STATUS_TFE_BITS        _u(0x00000004)
+#define I2C_IC_INTR_MASK_M_STOP_DET_BITS _u(0x00000200)
+#define I2C_IC_INTR_MASK_M_TX_ABRT_BITS  _u(0x00000040)
+#define I2C_IC_DMA_CR_TDMAE_BITS      _u(0x00000002)
+#define I2C_IC_DMA_CR_RDMAE_BITS      _u(0x00000001)
+
+uint i2c_init(i2c_inst_t *i2c, uint baudrate);
+int i2c_write_blocking(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src, size_t len, bool nostop);
+
+static inline i2c_hw_t *i2c_get_hw(i2c_inst_t *i2c) { return i2c->hw; }
+uint i2c_get_dreq(i2c_inst_t *i2c, bool is_tx);
+
+#endif
@@ -0,0 +1,14 @@
+// Mock das IRQs: o handler fica registrado, mas nada o chama (os módulos usam o poll)
+#ifndef MOCK_HARDWARE_IRQ_H
+#define MOCK_HARDWARE_IRQ_H
+
+#include "pico.h"
+
+typedef void (*irq_handler_t)(void);
+
+enum { DMA_IRQ_0 = 11, DMA_IRQ_1 = 12, I2C0_IRQ = 23, I2C1_IRQ = 24 };
+
+void irq_set_exclusive_handler(uint irq, irq_handler_t handler);
+void irq_set_enabled(uint irq, bool ligada);
+
+#endif
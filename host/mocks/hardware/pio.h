@@ -0,0 +1,29 @@
+// Mock do PIO: palavras escritas no FIFO TX (pelo DMA) ficam registradas por SM
+#ifndef MOCK_HARDWARE_PIO_H
+#define MOCK_HARDWARE_PIO_H
+
+#include "pico.h"
+
+typedef struct {
+    volatile uint32_t txf[4];
+} pio_hw_t;
+
+typedef pio_hw_t *PIO;
+
+extern pio_hw_t mock_pio0_hw;
+#define pio0 (&mock_pio0_hw)
+
+typedef struct pio_program {
+    const uint16_t *instructions;
+    uint8_t length;
+    int8_t origin;
+} pio_program_t;
+
+uint pio_add_program(PIO pio, const pio_program_t *programa);
+void pio_sm_claim(PIO pio, uint sm);
+void pio_sm_unclaim(PIO pio, uint sm);
+void pio_sm_set_enabled(PIO pio, uint sm, bool ligada);
+void pio_sm_set_clkdiv(PIO pio, uint sm, float div);
+uint pio_get_dreq(PIO pio, uint sm, bool is_tx);
+
+#endif
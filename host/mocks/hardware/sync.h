@@ -0,0 +1,16 @@
+// Mock dos spin locks: o host roda num só fio, então a trava só conta quem a segura
+#ifndef MOCK_HARDWARE_SYNC_H
+#define MOCK_HARDWARE_SYNC_H
+
+#include "pico.h"
+
+typedef volatile uint32_t spin_lock_t;
+
+int spin_lock_claim_unused(bool obrigatorio);
+spin_lock_t *spin_lock_instance(uint n);
+uint32_t spin_lock_blocking(spin_lock_t *trava);
+void spin_unlock(spin_lock_t *trava, uint32_t salvo);
+
+static inline void __dmb(void) {}
+
+#endif
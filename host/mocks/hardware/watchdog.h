@@ -0,0 +1,22 @@
+// Mock do watchdog: scratch em RAM e contagem de alimentações
+#ifndef MOCK_HARDWARE_WATCHDOG_H
+#define MOCK_HARDWARE_WATCHDOG_H
+
+#include "pico.h"
+
+typedef struct {
+    volatile uint32_t ctrl;
+    volatile uint32_t load;
+    volatile uint32_t reason;
+    volatile uint32_t scratch[8];
+    volatile uint32_t tick;
+} watchdog_hw_t;
+
+extern watchdog_hw_t mock_watchdog_hw;
+#define watchdog_hw (&mock_watchdog_hw)
+
+void watchdog_enable(uint32_t delay_ms, bool pause_on_debug);
+void watchdog_update(void);
+bool watchdog_enable_caused_reboot(void);
+
+#endif
@@ -0,0 +1,40 @@
+// Controle e inspeção dos mocks pelos testes de host
+#ifndef MOCK_HW_H
+#define MOCK_HW_H
+
+#include "pico.h"
+
+// Fluxo de contagens devolvido pelo ADC (FIFO lido pelo DMA ou adc_read()).
+// Ao fim do fluxo o ADC repete a última contagem.
+void mock_adc_carregar(const uint16_t *contagens, uint32_t n);
+uint32_t mock_adc_restantes(void);
+
+// Palavras que chegaram ao IC_DATA_CMD do i2c1: byte | bits STOP/RESTART.
+// i2c_write_blocking() marca STOP no último byte (sem nostop), como o hardware faria.
+uint32_t mock_i2c_palavras(const uint16_t **palavras);
+void mock_i2c_limpar(void);
+// Simula um NACK na próxima transferência por DMA, até mock_i2c_limpar_aborto()
+void mock_i2c_abortar(void);
+void mock_i2c_limpar_aborto(void);
+// Bytes devolvidos pelo FIFO RX do i2c1 às próximas leituras por DMA (depois, 0xFF)
+void mock_i2c_responder(const uint8_t *bytes, uint32_t n);
+
+// Palavras entregues ao FIFO TX da SM (quadros da matriz NeoPixel)
+uint32_t mock_pio_palavras(uint sm, const uint32_t **palavras);
+void mock_pio_limpar(void);
+
+// Flash: apagar_tudo deixa a memória toda em 0xFF e zera os apagamentos por setor
+void mock_flash_apagar_tudo(void);
+uint32_t mock_flash_apagamentos(uint32_t setor);
+// Recusa as próximas n chamadas de flash_safe_execute (núcleo 1 não liberou)
+void mock_flash_recusar(uint32_t n);
+// Depois de n operações, as seguintes se perdem (queda de energia)
+void mock_flash_cortar_apos(uint32_t n);
+void mock_flash_religar(void);
+
+
+// Watchdog: alimentações desde o início (0 enquanto não habilitado)
+uint32_t mock_watchdog_alimentacoes(void);
+bool mock_watchdog_habilitado(void);
+
+#endif
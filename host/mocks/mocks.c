@@ -0,0 +1,424 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: mocks.c
+ *  Projeto: TempCycleDMA
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Implementação dos mocks de hardware (ADC, DMA, i2c,
+ *      PIO, flash, watchdog, travas e tempo) usados pelo build de host. O DMA copia
+ *      tudo na hora do disparo; os periféricos guardam o que
+ *      receberam para os testes conferirem.
+ *
+ *  Relacionamento:
+ *      - host/teste_regressao.c
+ *
+ *
+ *  Data: 14/10/2026
+ * ------------------------------------------------------------
+ */
+
+#include <string.h>
+#include <time.h>
+#include "pico/time.h"
+#include "hardware/adc.h"
+#include "hardware/clocks.h"
+#include "hardware/dma.h"
+#include "hardware/i2c.h"
+#include "hardware/irq.h"
+#include "hardware/sync.h"
+#include "hardware/pio.h"
+#include "hardware/flash.h"
+#include "hardware/watchdog.h"
+#include "pico/flash.h"
+#include "mock_hw.h"
+
+// === Tempo ===
+
+static uint64_t relogio_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000u + (uint64_t)ts.tv_nsec / 1000u;
+}
+
+absolute_time_t get_absolute_time(void) {
+    static uint64_t boot_us = 0;
+    if (boot_us == 0) boot_us = relogio_us() - 1;
+    return relogio_us() - boot_us;
+}
+
+uint64_t time_us_64(void) {
+    return to_us_since_boot(get_absolute_time());
+}
+
+uint32_t time_us_32(void) {
+    return (uint32_t)time_us_64();
+}
+
+void sleep_us(uint64_t us) {
+    struct timespec ts = { (time_t)(us / 1000000u), (long)(us % 1000000u) * 1000 };
+    nanosleep(&ts, NULL);
+}
+
+void sleep_ms(uint32_t ms) {
+    sleep_us((uint64_t)ms * 1000u);
+}
+
+uint32_t clock_get_hz(enum clock_index clk_index) {
+    return clk_index == clk_sys ? 125000000u : 48000000u;
+}
+
+// === ADC ===
+
+static adc_hw_t adc_regs;
+adc_hw_t *const adc_hw = &adc_regs;
+
+static const uint16_t *adc_fluxo;
+static uint32_t adc_total, adc_pos;
+
+void mock_adc_carregar(const uint16_t *contagens, uint32_t n) {
+    adc_fluxo = contagens;
+    adc_total = n;
+    adc_pos = 0;
+}
+
+uint32_t mock_adc_restantes(void) {
+    return adc_total - adc_pos;
+}
+
+static uint16_t adc_proxima(void) {
+    if (adc_total == 0) return 0;
+    if (adc_pos < adc_total) return adc_fluxo[adc_pos++];
+    return adc_fluxo[adc_total - 1];
+}
+
+void adc_init(void) {}
+void adc_select_input(uint entrada) { (void)entrada; }
+void adc_set_temp_sensor_enabled(bool ligado) { (void)ligado; }
+void adc_set_clkdiv(float div) { (void)div; }
+void adc_fifo_setup(bool en, bool dreq_en, uint16_t dreq_thresh, bool err_in_fifo, bool byte_shift) {
+    (void)en; (void)dreq_en; (void)dreq_thresh; (void)err_in_fifo; (void)byte_shift;
+}
+void adc_fifo_drain(void) {}
+void adc_run(bool rodar) { (void)rodar; }
+
+uint16_t adc_read(void) {
+    return adc_proxima();
+}
+
+// === i2c ===
+
+static i2c_hw_t i2c0_regs, i2c1_regs = { .status = I2C_IC_STATUS_TFE_BITS };
+i2c_inst_t i2c0_inst = { &i2c0_regs }, i2c1_inst = { &i2c1_regs };
+
+#define I2C_REGISTRO_MAX 16384
+static uint16_t i2c_registro[I2C_REGISTRO_MAX];
+static uint32_t i2c_n;
+static bool i2c_nack;
+static uint8_t i2c_resposta[64];
+static uint32_t i2c_resposta_n, i2c_resposta_lidos;
+
+static void i2c_guardar(uint16_t palavra) {
+    if (i2c_n < I2C_REGISTRO_MAX) i2c_registro[i2c_n++] = palavra;
+}
+
+uint32_t mock_i2c_palavras(const uint16_t **palavras) {
+    *palavras = i2c_registro;
+    return i2c_n;
+}
+
+void mock_i2c_limpar(void) {
+    i2c_n = 0;
+}
+
+void mock_i2c_abortar(void) {
+    i2c_nack = true;
+}
+
+void mock_i2c_limpar_aborto(void) {
+    i2c_nack = false;
+    i2c1_regs.tx_abrt_source = 0;
+}
+
+void mock_i2c_responder(const uint8_t *bytes, uint32_t n) {
+    if (n > sizeof(i2c_resposta)) n = sizeof(i2c_resposta);
+    memcpy(i2c_resposta, bytes, n);
+    i2c_resposta_n = n;
+    i2c_resposta_lidos = 0;
+}
+
+static uint8_t i2c_ler_resposta(void) {
+    return i2c_resposta_lidos < i2c_resposta_n ? i2c_resposta[i2c_resposta_lidos++] : 0xFF;
+}
+
+uint i2c_init(i2c_inst_t *i2c, uint baudrate) {
+    (void)i2c;
+    return baudrate;
+}
+
+int i2c_write_blocking(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src, size_t len, bool nostop) {
+    (void)addr;
+    if (i2c != i2c1) return (int)len;
+    for (size_t i = 0; i < len; i++) {
+        uint16_t p = src[i];
+        if (i == len - 1 && !nostop) p |= I2C_IC_DATA_CMD_STOP_BITS;
+        i2c_guardar(p);
+    }
+    return (int)len;
+}
+
+uint i2c_get_dreq(i2c_inst_t *i2c, bool is_tx) {
+    if (i2c == i2c1) return is_tx ? DREQ_I2C1_TX : DREQ_I2C1_RX;
+    return is_tx ? DREQ_I2C0_TX : DREQ_I2C0_RX;
+}
+
+// === PIO ===
+
+pio_hw_t mock_pio0_hw;
+
+#define PIO_REGISTRO_MAX 4096
+static uint32_t pio_registro[4][PIO_REGISTRO_MAX];
+static uint32_t pio_n[4];
+
+uint32_t mock_pio_palavras(uint sm, const uint32_t **palavras) {
+    *palavras = pio_registro[sm];
+    return pio_n[sm];
+}
+
+void mock_pio_limpar(void) {
+    memset(pio_n, 0, sizeof(pio_n));
+}
+
+uint pio_add_program(PIO pio, const pio_program_t *programa) {
+    (void)pio; (void)programa;
+    return 0;
+}
+
+void pio_sm_claim(PIO pio, uint sm) { (void)pio; (void)sm; }
+void pio_sm_unclaim(PIO pio, uint sm) { (void)pio; (void)sm; }
+void pio_sm_set_enabled(PIO pio, uint sm, bool ligada) { (void)pio; (void)sm; (void)ligada; }
+void pio_sm_set_clkdiv(PIO pio, uint sm, float div) { (void)pio; (void)sm; (void)div; }
+
+uint pio_get_dreq(PIO pio, uint sm, bool is_tx) {
+    (void)pio; (void)is_tx;
+    return DREQ_PIO0_TX0 + sm;
+}
+
+void mock_pio_iniciar_sm(PIO pio, uint sm, uint offset, uint pino, float freq) {
+    (void)pio; (void)offset; (void)pino; (void)freq;
+    pio_n[sm] = 0;
+}
+
+// === DMA ===
+
+static uint16_t dma_ocupados;   // Canais reservados (bit n = canal n)
+
+dma_channel_config dma_channel_get_default_config(uint canal) {
+    (void)canal;
+    dma_channel_config c = { DMA_SIZE_32, true, false, 0x3f };
+    return c;
+}
+
+void channel_config_set_transfer_data_size(dma_channel_config *c, enum dma_channel_transfer_size t) { c->tamanho = t; }
+void channel_config_set_read_increment(dma_channel_config *c, bool incr) { c->incr_leitura = incr; }
+void channel_config_set_write_increment(dma_channel_config *c, bool incr) { c->incr_escrita = incr; }
+void channel_config_set_dreq(dma_channel_config *c, uint dreq) { c->dreq = dreq; }
+
+static uint32_t dma_ler(const volatile void *origem, enum dma_channel_transfer_size t) {
+    if (origem == &adc_hw->fifo) return adc_proxima();
+    if (origem == &i2c1_regs.data_cmd) return i2c_ler_resposta();
+    switch (t) {
+        case DMA_SIZE_8:  return *(const volatile uint8_t *)origem;
+        case DMA_SIZE_16: return *(const volatile uint16_t *)origem;
+        default:          return *(const volatile uint32_t *)origem;
+    }
+}
+
+static void dma_escrever(volatile void *destino, enum dma_channel_transfer_size t, uint32_t v) {
+    if (destino == &i2c1_regs.data_cmd) {
+        i2c_guardar((uint16_t)v);
+        return;
+    }
+    for (uint sm = 0; sm < 4; sm++) {
+        if (destino == &mock_pio0_hw.txf[sm]) {
+            if (pio_n[sm] < PIO_REGISTRO_MAX) pio_registro[sm][pio_n[sm]++] = v;
+            return;
+        }
+    }
+    switch (t) {
+        case DMA_SIZE_8:  *(volatile uint8_t *)destino = (uint8_t)v; break;
+        case DMA_SIZE_16: *(volatile uint16_t *)destino = (uint16_t)v; break;
+        default:          *(volatile uint32_t *)destino = v; break;
+    }
+}
+
+void dma_channel_configure(uint canal, const dma_channel_config *c, volatile void *destino,
+                           const volatile void *origem, uint n, bool disparar) {
+    (void)canal;
+    if (!disparar) return;
+
+    if (destino == &i2c1_regs.data_cmd && i2c_nack) {
+        i2c1_regs.tx_abrt_source = 1;   // Endereço sem ACK: nada chega ao barramento
+        return;
+    }
+
+    const uint passo = 1u << c->tamanho;
+    const volatile uint8_t *o = origem;
+    volatile uint8_t *d = destino;
+    for (uint i = 0; i < n; i++) {
+        dma_escrever(d, c->tamanho, dma_ler(o, c->tamanho));
+        if (c->incr_leitura) o += passo;
+        if (c->incr_escrita) d += passo;
+    }
+}
+
+bool dma_channel_is_busy(uint canal) {
+    (void)canal;
+    return false;
+}
+
+void dma_channel_wait_for_finish_blocking(uint canal) { (void)canal; }
+void dma_channel_abort(uint canal) { (void)canal; }
+
+void dma_channel_claim(uint canal) {
+    dma_ocupados |= (uint16_t)(1u << canal);
+}
+
+void dma_channel_unclaim(uint canal) {
+    dma_ocupados &= (uint16_t)~(1u << canal);
+}
+
+int dma_claim_unused_channel(bool obrigatorio) {
+    for (uint canal = 0; canal < NUM_DMA_CHANNELS; canal++) {
+        if (!(dma_ocupados & (1u << canal))) {
+            dma_channel_claim(canal);
+            return (int)canal;
+        }
+    }
+    assert(!obrigatorio);
+    return -1;
+}
+
+// === Travas e IRQs ===
+
+static spin_lock_t travas[32];
+static uint32_t travas_ocupadas;
+
+int spin_lock_claim_unused(bool obrigatorio) {
+    for (uint n = 0; n < count_of(travas); n++) {
+        if (!(travas_ocupadas & (1u << n))) {
+            travas_ocupadas |= 1u << n;
+            return (int)n;
+        }
+    }
+    assert(!obrigatorio);
+    return -1;
+}
+
+spin_lock_t *spin_lock_instance(uint n) {
+    return &travas[n];
+}
+
+uint32_t spin_lock_blocking(spin_lock_t *trava) {
+    assert(*trava == 0);   // Um só fio: trava já presa seria um impasse no alvo
+    *trava = 1;
+    return 0;
+}
+
+void spin_unlock(spin_lock_t *trava, uint32_t salvo) {
+    (void)salvo;
+    *trava = 0;
+}
+
+void irq_set_exclusive_handler(uint irq, irq_handler_t handler) { (void)irq; (void)handler; }
+void irq_set_enabled(uint irq, bool ligada) { (void)irq; (void)ligada; }
+
+// === Flash ===
+
+uint8_t mock_flash[PICO_FLASH_SIZE_BYTES];
+static uint32_t flash_apagamentos[PICO_FLASH_SIZE_BYTES / FLASH_SECTOR_SIZE];
+static uint32_t flash_recusas = 0;
+static uint32_t flash_restantes = UINT32_MAX;   // Operações até o "corte"
+
+void mock_flash_apagar_tudo(void) {
+    memset(mock_flash, 0xFF, sizeof(mock_flash));
+    memset(flash_apagamentos, 0, sizeof(flash_apagamentos));
+}
+
+uint32_t mock_flash_apagamentos(uint32_t setor) {
+    return flash_apagamentos[setor];
+}
+
+void mock_flash_recusar(uint32_t n) {
+    flash_recusas = n;
+}
+
+void mock_flash_cortar_apos(uint32_t n) {
+    flash_restantes = n;
+}
+
+void mock_flash_religar(void) {
+    flash_restantes = UINT32_MAX;
+}
+
+static bool flash_energizada(void) {
+    if (flash_restantes == 0) return false;
+    if (flash_restantes != UINT32_MAX) flash_restantes--;
+    return true;
+}
+
+void flash_range_erase(uint32_t offset, size_t n) {
+    assert(offset % FLASH_SECTOR_SIZE == 0 && n % FLASH_SECTOR_SIZE == 0);
+    assert(offset + n <= sizeof(mock_flash));
+    if (!flash_energizada()) return;
+    memset(&mock_flash[offset], 0xFF, n);
+    for (size_t s = 0; s < n / FLASH_SECTOR_SIZE; s++) flash_apagamentos[offset / FLASH_SECTOR_SIZE + s]++;
+}
+
+void flash_range_program(uint32_t offset, const uint8_t *dados, size_t n) {
+    assert(offset % FLASH_PAGE_SIZE == 0 && n % FLASH_PAGE_SIZE == 0);
+    assert(offset + n <= sizeof(mock_flash));
+    if (!flash_energizada()) return;
+    for (size_t i = 0; i < n; i++) mock_flash[offset + i] &= dados[i];
+}
+
+int flash_safe_execute(void (*fn)(void *), void *param, uint32_t timeout_ms) {
+    (void)timeout_ms;
+    if (flash_recusas > 0) {
+        flash_recusas--;
+        return PICO_ERROR_TIMEOUT;
+    }
+    fn(param);
+    return PICO_OK;
+}
+
+bool flash_safe_execute_core_init(void) {
+    return true;
+}
+
+// === Watchdog ===
+
+watchdog_hw_t mock_watchdog_hw;
+static bool watchdog_ligado = false;
+static uint32_t watchdog_alimentacoes = 0;
+
+void watchdog_enable(uint32_t delay_ms, bool pause_on_debug) {
+    (void)pause_on_debug;
+    mock_watchdog_hw.load = delay_ms * 1000u;
+    watchdog_ligado = true;
+}
+
+void watchdog_update(void) {
+    if (watchdog_ligado) watchdog_alimentacoes++;
+}
+
+bool watchdog_enable_caused_reboot(void) {
+    return false;
+}
+
+uint32_t mock_watchdog_alimentacoes(void) {
+    return watchdog_alimentacoes;
+}
+
+bool mock_watchdog_habilitado(void) {
+    return watchdog_ligado;
+}
@@ -0,0 +1,22 @@
+// Mock do pico.h para o build de host: só o que os módulos portáveis usam
+#ifndef MOCK_PICO_H
+#define MOCK_PICO_H
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef unsigned int uint;
+
+#define _u(x) x##u
+#define count_of(a) (sizeof(a) / sizeof((a)[0]))
+#define __not_in_flash_func(f) f
+#define __time_critical_func(f) f
+
+#define PICO_ON_DEVICE 0
+#define PICO_FLASH_SIZE_BYTES (2u * 1024u * 1024u)
+
+static inline void tight_loop_contents(void) {}
+
+#endif
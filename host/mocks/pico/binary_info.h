@@ -0,0 +1,6 @@
+#ifndef MOCK_PICO_BINARY_INFO_H
+#define MOCK_PICO_BINARY_INFO_H
+
+#define bi_decl(x)
+
+#endif
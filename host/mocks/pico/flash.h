@@ -0,0 +1,13 @@
+// Mock do pico/flash.h: a função roda na hora, a menos que o teste peça recusa
+#ifndef MOCK_PICO_FLASH_H
+#define MOCK_PICO_FLASH_H
+
+#include "pico.h"
+
+#define PICO_OK 0
+#define PICO_ERROR_TIMEOUT (-1)
+
+int flash_safe_execute(void (*fn)(void *), void *param, uint32_t timeout_ms);
+bool flash_safe_execute_core_init(void);
+
+#endif
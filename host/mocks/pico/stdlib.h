@@ -0,0 +1,8 @@
+#ifndef MOCK_PICO_STDLIB_H
+#define MOCK_PICO_STDLIB_H
+
+#include <stdio.h>
+#include "pico.h"
+#include "pico/time.h"
+
+#endif
@@ -0,0 +1,24 @@
+// Tempo do host (CLOCK_MONOTONIC), contado a partir da primeira leitura como se fosse o boot
+#ifndef MOCK_PICO_TIME_H
+#define MOCK_PICO_TIME_H
+
+#include "pico.h"
+
+typedef uint64_t absolute_time_t;
+
+absolute_time_t get_absolute_time(void);
+uint64_t time_us_64(void);
+uint32_t time_us_32(void);
+void sleep_us(uint64_t us);
+void sleep_ms(uint32_t ms);
+
+static inline uint64_t to_us_since_boot(absolute_time_t t) { return t; }
+static inline uint32_t to_ms_since_boot(absolute_time_t t) { return (uint32_t)(t / 1000); }
+static inline int64_t absolute_time_diff_us(absolute_time_t de, absolute_time_t ate) {
+    return (int64_t)(ate - de);
+}
+static inline absolute_time_t make_timeout_time_us(uint64_t us) { return get_absolute_time() + us; }
+static inline absolute_time_t make_timeout_time_ms(uint32_t ms) { return get_absolute_time() + ms * 1000ull; }
+static inline bool time_reached(absolute_time_t t) { return get_absolute_time() >= t; }
+
+#endif
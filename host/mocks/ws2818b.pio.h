@@ -0,0 +1,22 @@
+// Substitui o cabeçalho gerado pelo pioasm: o programa não roda no host,
+// só a inicialização é registrada
+#ifndef MOCK_WS2818B_PIO_H
+#define MOCK_WS2818B_PIO_H
+
+#include "hardware/pio.h"
+
+static const uint16_t ws2818b_program_instructions[] = { 0x6221, 0x1123, 0x1400, 0xa442 };
+
+static const struct pio_program ws2818b_program = {
+    .instructions = ws2818b_program_instructions,
+    .length = 4,
+    .origin = -1,
+};
+
+void mock_pio_iniciar_sm(PIO pio, uint sm, uint offset, uint pino, float freq);
+
+static inline void ws2818b_program_init(PIO pio, uint sm, uint offset, uint pin, float freq) {
+    mock_pio_iniciar_sm(pio, sm, offset, pin, freq);
+}
+
+#endif
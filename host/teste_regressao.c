@@ -0,0 +1,1375 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: teste_regressao.c
+ *  Projeto: TempCycleDMA
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Testes de regressão e desempenho dos módulos portáveis,
+ *      rodando no host sobre os mocks de host/mocks.
+ *
+ *      Um fluxo de contagens do ADC (sintético ou gravado) é
+ *      reproduzido pelo mesmo caminho do firmware: DMA do FIFO
+ *      em blocos, redução, média da janela em m°C e tendência.
+ *      Depois confere o framebuffer do OLED (checksums dos
+ *      dígitos grandes, blit x set_pixel, envio só da
+ *      diferença, gráfico de varredura), o árbitro do i2c
+ *      (prioridade entre páginas, leitura, NACK), o
+ *      empacotamento da matriz NeoPixel, o
+ *      histórico em flash (voltas no anel, boot, queda de
+ *      energia, desgaste), o supervisor do watchdog, o registro
+ *      de parâmetros (faixas, recusa, flash), os tópicos
+ *      versionados, o sequenciador do boot e mede a vazão dos caminhos quentes
+ *      contra limites folgados.
+ *
+ *      Uso:
+ *          teste_regressao [--sem-limites] [captura.txt]
+ *
+ *      A captura é texto com uma contagem por linha (linhas
+ *      com '#' são ignoradas), do sensor interno a 1024 sps.
+ *      Sai com código 1 se algum item falhar.
+ *
+ *  Relacionamento:
+ *      - reducao.c, tarefa3_tendencia.c
+ *      - inc/ssd1306_i2c.c, inc/big_string_drawer.c,
+ *        inc/display_utils.c
+ *      - LabNeoPixel/neopixel_driver.c, matriz.c, animacao.c
+ *      - historico.c, supervisor.c, grafico_oled.c, parametros.c,
+ *        topicos.c, barramento_i2c.c, boot.c
+ *
+ *
+ *  Data: 14/10/2026
+ * ------------------------------------------------------------
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "hardware/adc.h"
+#include "hardware/dma.h"
+#include "mock_hw.h"
+#include "reducao.h"
+#include "tarefa3_tendencia.h"
+#include "ssd1306.h"
+#include "draw_big_char.h"
+#include "display_utils.h"
+#include "formatacao.h"
+#include "LabNeoPixel/neopixel_driver.h"
+#include "LabNeoPixel/animacao.h"
+#include "hardware/flash.h"
+#include "hardware/watchdog.h"
+#include "historico.h"
+#include "supervisor.h"
+#include "grafico_oled.h"
+#include "parametros.h"
+#include "topicos.h"
+#include "barramento_i2c.h"
+#include "boot.h"
+
+#define BLOCO 256
+#define BLOCOS_POR_JANELA 2            // Janela de 0,5 s a 1024 sps, como no firmware
+#define AMOSTRAS_JANELA (BLOCO * BLOCOS_POR_JANELA)
+#define AMOSTRAS_MAX (1u << 20)
+
+static int falhas = 0;
+
+#define CONFERIR(cond, ...) do {                               \
+        if (!(cond)) {                                         \
+            falhas++;                                          \
+            printf("FALHA %s:%d: ", __FILE__, __LINE__);       \
+            printf(__VA_ARGS__);                               \
+            printf("\n");                                      \
+        }                                                      \
+    } while (0)
+
+static const calib_temp_t calib = CALIB_TEMP_PADRAO;
+static uint16_t fluxo[AMOSTRAS_MAX];
+static uint32_t n_fluxo;
+
+// === Fluxo de amostras ===
+
+// Perfil sintético por janela: patamar, subida, patamar, descida
+#define SEG_JANELAS 32
+#define RAMPA_C_POR_JANELA 0.25
+
+enum { SEG_PATAMAR, SEG_SUBIDA, SEG_PATAMAR_ALTO, SEG_DESCIDA, SEG_TOTAL };
+
+static uint32_t lcg = 12345u;
+
+static double ruido_uniforme(void) {
+    lcg = lcg * 1664525u + 1013904223u;
+    return (lcg >> 8) / (double)(1u << 24);
+}
+
+static double temperatura_perfil(uint32_t janela) {
+    uint32_t seg = janela / SEG_JANELAS, k = janela % SEG_JANELAS;
+    double alto = 25.0 + SEG_JANELAS * RAMPA_C_POR_JANELA;
+    switch (seg) {
+        case SEG_PATAMAR:      return 25.0;
+        case SEG_SUBIDA:       return 25.0 + (k + 1) * RAMPA_C_POR_JANELA;
+        case SEG_PATAMAR_ALTO: return alto;
+        default:               return alto - (k + 1) * RAMPA_C_POR_JANELA;
+    }
+}
+
+// Contagens como as do sensor: tensão da calibração padrão e ruído triangular de ±1,5 LSB
+static void gerar_fluxo_sintetico(void) {
+    n_fluxo = 0;
+    for (uint32_t j = 0; j < SEG_TOTAL * SEG_JANELAS; j++) {
+        double v_uv = calib.v27_uv - (temperatura_perfil(j) - 27.0) * calib.inclinacao_uv_c;
+        double ideal = v_uv * 4096.0 / calib.vref_uv;
+        for (uint32_t i = 0; i < AMOSTRAS_JANELA; i++) {
+            double c = ideal + 1.5 * (ruido_uniforme() - ruido_uniforme());
+            long v = lround(c);
+            fluxo[n_fluxo++] = (uint16_t)(v < 0 ? 0 : v > 4095 ? 4095 : v);
+        }
+    }
+}
+
+static bool carregar_captura(const char *caminho) {
+    FILE *f = fopen(caminho, "r");
+    if (!f) {
+        printf("nao abriu %s\n", caminho);
+        return false;
+    }
+
+    char linha[64];
+    n_fluxo = 0;
+    while (n_fluxo < AMOSTRAS_MAX && fgets(linha, sizeof(linha), f)) {
+        if (linha[0] == '#') continue;
+        char *fim;
+        unsigned long v = strtoul(linha, &fim, 10);
+        if (fim == linha) continue;
+        fluxo[n_fluxo++] = (uint16_t)(v > 4095 ? 4095 : v);
+    }
+    fclose(f);
+    return n_fluxo >= AMOSTRAS_JANELA;
+}
+
+// === Aquisição, redução e tendência ===
+
+static int canal_dma;
+
+// Mesmo DMA do firmware: FIFO do ADC (sem incremento) para o buffer, 16 bits, DREQ do ADC
+static void adquirir_bloco(uint16_t *bloco) {
+    dma_channel_config c = dma_channel_get_default_config(canal_dma);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, true);
+    channel_config_set_dreq(&c, DREQ_ADC);
+    dma_channel_configure(canal_dma, &c, bloco, &adc_hw->fifo, BLOCO, true);
+}
+
+static double media_mC_referencia(const uint16_t *a, uint32_t n) {
+    double soma = 0.0;
+    for (uint32_t i = 0; i < n; i++) soma += a[i];
+    double v_uv = soma / n * calib.vref_uv / 4096.0;
+    return 27000.0 - (v_uv - calib.v27_uv) * 1000.0 / calib.inclinacao_uv_c;
+}
+
+static void testar_reducao_intercalada(void) {
+    // Blocos que não são múltiplos de 5: a fase precisa continuar entre eles
+    static const uint32_t tamanhos[] = { 256, 7, 128, 1, 33 };
+    static reducao_hist_t hist;
+    uint32_t soma[ADC_NUM_CANAIS] = {0}, cont[ADC_NUM_CANAIS] = {0};
+    uint64_t soma_q[ADC_NUM_CANAIS] = {0}, ref_soma_q[ADC_NUM_CANAIS] = {0};
+    uint16_t vmin[ADC_NUM_CANAIS], vmax[ADC_NUM_CANAIS] = {0};
+    uint32_t ref_soma[ADC_NUM_CANAIS] = {0}, ref_cont[ADC_NUM_CANAIS] = {0};
+    uint16_t ref_min[ADC_NUM_CANAIS], ref_max[ADC_NUM_CANAIS] = {0};
+    for (int k = 0; k < ADC_NUM_CANAIS; k++) vmin[k] = ref_min[k] = 0xFFFF;
+
+    // Histograma do sensor (última posição do round-robin), como na Tarefa 1
+    reducao_hist_iniciar(&hist, fluxo[ADC_CANAL_TEMP]);
+
+    uint32_t pos = 0;
+    uint8_t fase = 0;
+    for (unsigned t = 0; t < count_of(tamanhos); t++) {
+        reducao_bloco_t r;
+        fase = reducao_bloco_hist(&fluxo[pos], tamanhos[t], ADC_NUM_CANAIS, fase, &hist, ADC_CANAL_TEMP, &r);
+        for (int k = 0; k < ADC_NUM_CANAIS; k++) {
+            soma[k] += r.soma[k];
+            soma_q[k] += r.soma_q[k];
+            cont[k] += r.cont[k];
+            if (r.cont[k] && r.vmin[k] < vmin[k]) vmin[k] = r.vmin[k];
+            if (r.cont[k] && r.vmax[k] > vmax[k]) vmax[k] = r.vmax[k];
+        }
+        pos += tamanhos[t];
+    }
+
+    for (uint32_t i = 0; i < pos; i++) {
+        int k = i % ADC_NUM_CANAIS;
+        ref_soma[k] += fluxo[i];
+        ref_soma_q[k] += (uint64_t)fluxo[i] * fluxo[i];
+        ref_cont[k]++;
+        if (fluxo[i] < ref_min[k]) ref_min[k] = fluxo[i];
+        if (fluxo[i] > ref_max[k]) ref_max[k] = fluxo[i];
+    }
+
+    CONFERIR(fase == pos % ADC_NUM_CANAIS, "fase final %u, esperada %u", fase, pos % ADC_NUM_CANAIS);
+    for (int k = 0; k < ADC_NUM_CANAIS; k++) {
+        CONFERIR(soma[k] == ref_soma[k] && cont[k] == ref_cont[k] &&
+                 vmin[k] == ref_min[k] && vmax[k] == ref_max[k],
+                 "canal %d: soma %u/%u cont %u/%u min %u/%u max %u/%u", k,
+                 soma[k], ref_soma[k], cont[k], ref_cont[k], vmin[k], ref_min[k], vmax[k], ref_max[k]);
+        CONFERIR(soma_q[k] == ref_soma_q[k], "canal %d: soma dos quadrados %llu/%llu", k,
+                 (unsigned long long)soma_q[k], (unsigned long long)ref_soma_q[k]);
+    }
+
+    uint32_t no_hist = hist.abaixo + hist.acima;
+    uint64_t soma_hist = hist.soma_abaixo + hist.soma_acima;
+    for (int b = 0; b < REDUCAO_HIST_BINS; b++) {
+        no_hist += hist.bins[b];
+        soma_hist += (uint64_t)hist.bins[b] * (hist.base + b);
+    }
+    CONFERIR(no_hist == ref_cont[ADC_CANAL_TEMP] && soma_hist == ref_soma[ADC_CANAL_TEMP],
+             "histograma do sensor: %u amostras (%u), soma %llu (%u)", no_hist, ref_cont[ADC_CANAL_TEMP],
+             (unsigned long long)soma_hist, ref_soma[ADC_CANAL_TEMP]);
+}
+
+static int comparar_u16(const void *a, const void *b) {
+    return (int)*(const uint16_t *)a - (int)*(const uint16_t *)b;
+}
+
+// Janela com picos: a mediana e a média aparada não podem se mover
+static void testar_estatisticas_robustas(void) {
+    static reducao_hist_t hist;
+    uint16_t janela[AMOSTRAS_JANELA], ordenada[AMOSTRAS_JANELA];
+    memcpy(janela, fluxo, sizeof(janela));
+    for (int i = 0; i < 8; i++) janela[37 + i * 53] = 4095;   // Picos acima da faixa
+    for (int i = 0; i < 4; i++) janela[11 + i * 97] = 0;      // e abaixo dela
+
+    // Bloco desalinhado no meio, para passar pelos dois caminhos de leitura
+    static const uint32_t tamanhos[] = { 255, 1, 256 };
+    uint64_t soma = 0, soma_q = 0;
+    uint32_t pos = 0;
+    reducao_hist_iniciar(&hist, fluxo[0]);
+    for (unsigned t = 0; t < count_of(tamanhos); t++) {
+        reducao_bloco_t r;
+        reducao_bloco_hist(&janela[pos], tamanhos[t], 1, 0, &hist, 0, &r);
+        soma += r.soma[0];
+        soma_q += r.soma_q[0];
+        pos += tamanhos[t];
+    }
+
+    memcpy(ordenada, janela, sizeof(janela));
+    qsort(ordenada, AMOSTRAS_JANELA, sizeof(uint16_t), comparar_u16);
+    uint32_t k = AMOSTRAS_JANELA >> REDUCAO_APARO_SHIFT;
+    uint64_t ref_aparada = 0;
+    for (uint32_t i = k; i < AMOSTRAS_JANELA - k; i++) ref_aparada += ordenada[i];
+    uint16_t ref_mediana = (uint16_t)((ordenada[AMOSTRAS_JANELA / 2 - 1] + ordenada[AMOSTRAS_JANELA / 2] + 1) / 2);
+
+    reducao_robusta_t rb;
+    CONFERIR(reducao_robusta(&hist, &rb) && rb.na_faixa, "histograma vazio ou fora da faixa");
+    CONFERIR(rb.mediana == ref_mediana, "mediana %u, esperada %u", rb.mediana, ref_mediana);
+    CONFERIR(rb.soma_aparada == ref_aparada && rb.n_aparada == AMOSTRAS_JANELA - 2 * k,
+             "aparada %llu/%u, esperada %llu/%u", (unsigned long long)rb.soma_aparada, rb.n_aparada,
+             (unsigned long long)ref_aparada, AMOSTRAS_JANELA - 2 * k);
+
+    // Desvio padrão contra a referência em double
+    double media = (double)soma / AMOSTRAS_JANELA, var = 0.0;
+    for (uint32_t i = 0; i < AMOSTRAS_JANELA; i++) var += (janela[i] - media) * (janela[i] - media);
+    double desvio_uv = sqrt(var / AMOSTRAS_JANELA) * calib.vref_uv / 4096.0;
+    uint32_t desvio = reducao_desvio_uV(&calib, soma, soma_q, AMOSTRAS_JANELA);
+    CONFERIR(fabs(desvio - desvio_uv) <= 4.0, "desvio %u µV, referencia %.1f", desvio, desvio_uv);
+    uint32_t desvio_mC = reducao_desvio_mC(&calib, soma, soma_q, AMOSTRAS_JANELA);
+    double ref_mC = desvio_uv * 1000.0 / calib.inclinacao_uv_c;
+    CONFERIR(fabs(desvio_mC - ref_mC) <= 3.0, "desvio %u m°C, referencia %.1f", desvio_mC, ref_mC);
+
+    int32_t media_mC = reducao_media_mC(&calib, soma, AMOSTRAS_JANELA);
+    int32_t mediana_mC = reducao_media_mC(&calib, rb.mediana, 1);
+    int32_t aparada_mC = reducao_media_mC(&calib, rb.soma_aparada, rb.n_aparada);
+    int32_t limpa_mC = (int32_t)lround(media_mC_referencia(fluxo, AMOSTRAS_JANELA));
+    CONFERIR(abs(aparada_mC - limpa_mC) < abs(media_mC - limpa_mC),
+             "aparada %d m°C nao ficou mais perto de %d que a media %d", aparada_mC, limpa_mC, media_mC);
+
+    // Faixa longe das amostras: tudo abaixo dela, resultado só aproximado
+    reducao_hist_iniciar(&hist, 4000);
+    reducao_robusta_t fora;
+    reducao_bloco_t r;
+    reducao_bloco_hist(fluxo, AMOSTRAS_JANELA, 1, 0, &hist, 0, &r);
+    CONFERIR(reducao_robusta(&hist, &fora) && !fora.na_faixa && hist.abaixo == AMOSTRAS_JANELA,
+             "faixa deslocada: na_faixa %d abaixo %u", fora.na_faixa, hist.abaixo);
+
+    printf("# robustas: media %d mediana %d aparada %d m°C (sem picos %d), desvio %u m°C\n",
+           media_mC, mediana_mC, aparada_mC, limpa_mC, desvio_mC);
+}
+
+static void testar_aquisicao(bool sintetico) {
+    static tendencia_t tendencias[AMOSTRAS_MAX / AMOSTRAS_JANELA];
+    uint16_t janela[AMOSTRAS_JANELA];
+    uint32_t n_janelas = n_fluxo / AMOSTRAS_JANELA;
+    int32_t erro_max_mC = 0;
+
+    // Uma média a cada janela de 0,5 s; ajuste sobre 8 s
+    const config_tendencia_t cfg_tend = { 16, 500, 1, 300, 150 };
+    tarefa3_configurar(&cfg_tend);
+
+    mock_adc_carregar(fluxo, n_fluxo);
+    for (uint32_t j = 0; j < n_janelas; j++) {
+        uint64_t soma = 0;
+        uint32_t cont = 0;
+        uint16_t lo = 0xFFFF, hi = 0;
+
+        for (int b = 0; b < BLOCOS_POR_JANELA; b++) {
+            uint16_t *bloco = &janela[b * BLOCO];
+            reducao_bloco_t r;
+            adquirir_bloco(bloco);
+            reducao_bloco(bloco, BLOCO, 1, 0, &r);
+            soma += r.soma[0];
+            cont += r.cont[0];
+            if (r.vmin[0] < lo) lo = r.vmin[0];
+            if (r.vmax[0] > hi) hi = r.vmax[0];
+        }
+
+        // O DMA tem que ter entregado exatamente o trecho do fluxo desta janela
+        const uint16_t *esperado = &fluxo[j * AMOSTRAS_JANELA];
+        CONFERIR(memcmp(janela, esperado, sizeof(janela)) == 0, "janela %u: DMA fora de ordem", j);
+
+        uint16_t ref_lo = 0xFFFF, ref_hi = 0;
+        for (uint32_t i = 0; i < AMOSTRAS_JANELA; i++) {
+            if (esperado[i] < ref_lo) ref_lo = esperado[i];
+            if (esperado[i] > ref_hi) ref_hi = esperado[i];
+        }
+        CONFERIR(cont == AMOSTRAS_JANELA && lo == ref_lo && hi == ref_hi,
+                 "janela %u: cont %u min %u/%u max %u/%u", j, cont, lo, ref_lo, hi, ref_hi);
+
+        int32_t mC = reducao_media_mC(&calib, soma, cont);
+        int32_t erro = (int32_t)lround(mC - media_mC_referencia(esperado, AMOSTRAS_JANELA));
+        if (abs(erro) > erro_max_mC) erro_max_mC = abs(erro);
+
+        tendencias[j] = tarefa3_atualizar(mC, NULL);
+    }
+
+    CONFERIR(erro_max_mC <= 1, "ponto fixo difere da referencia em %d m°C", erro_max_mC);
+    CONFERIR(mock_adc_restantes() == n_fluxo % AMOSTRAS_JANELA, "sobraram %u amostras", mock_adc_restantes());
+
+    uint32_t por_tipo[3] = {0};
+    for (uint32_t j = 0; j < n_janelas; j++) por_tipo[tendencias[j]]++;
+    printf("# aquisicao: %u janelas, erro max %d m°C, estavel %u subindo %u caindo %u\n",
+           n_janelas, erro_max_mC, por_tipo[TENDENCIA_ESTÁVEL], por_tipo[TENDENCIA_SUBINDO],
+           por_tipo[TENDENCIA_CAINDO]);
+
+    if (!sintetico) return;
+
+    // Nas rampas a tendência acompanha o sentido depois de poucas médias; nos patamares,
+    // passado o atraso do ajuste e da suavização, o ruído não pode virar a tendência
+    uint32_t oscilacoes = 0;
+    for (uint32_t j = 0; j < n_janelas; j++) {
+        uint32_t seg = j / SEG_JANELAS, k = j % SEG_JANELAS;
+        tendencia_t t = tendencias[j];
+        if (seg == SEG_SUBIDA && k >= 3) {
+            CONFERIR(t == TENDENCIA_SUBINDO, "janela %u na subida: %s", j, tendencia_para_texto(t));
+        } else if (seg == SEG_DESCIDA && k >= 3) {
+            CONFERIR(t == TENDENCIA_CAINDO, "janela %u na descida: %s", j, tendencia_para_texto(t));
+        } else if ((seg == SEG_PATAMAR || k >= SEG_JANELAS * 3 / 4) && t != TENDENCIA_ESTÁVEL) {
+            oscilacoes++;
+        }
+    }
+    CONFERIR(oscilacoes == 0, "%u oscilacoes nos patamares", oscilacoes);
+}
+
+// Inclinação incremental contra a regressão refeita do zero, e a histerese
+static void testar_tendencia(void) {
+    const config_tendencia_t cfg_reta = { 10, 1500, 0, 1000000, 1000000 };
+    static int32_t ys[200];
+    resultado_tendencia_t res;
+    int32_t erro_max = 0;
+
+    tarefa3_configurar(&cfg_reta);
+    for (int i = 0; i < (int)count_of(ys); i++) {
+        ys[i] = 25000 + i * 7 + (int32_t)(ruido_uniforme() * 400.0) - 200;
+        tarefa3_atualizar(ys[i], &res);
+
+        int k = i + 1 < cfg_reta.janela ? i + 1 : cfg_reta.janela;
+        double sx = 0, sy = 0, sxx = 0, sxy = 0;
+        for (int x = 0; x < k; x++) {
+            double y = ys[i - k + 1 + x];
+            sx += x; sy += y; sxx += (double)x * x; sxy += x * y;
+        }
+        double ref = (k < 2) ? 0.0 : (k * sxy - sx * sy) / (k * sxx - sx * sx) * 60000.0 / cfg_reta.periodo_ms;
+        int32_t erro = abs(res.inclinacao_mC_min - (int32_t)lround(ref));
+        if (erro > erro_max) erro_max = erro;
+        CONFERIR(res.amostras == k, "amostras %u, esperado %d", res.amostras, k);
+    }
+    CONFERIR(erro_max <= 1, "inclinacao incremental difere da referencia em %d m°C/min", erro_max);
+
+    // Retas exatas a 1 amostra/s: 5 m°C/amostra = 300 m°C/min
+    static const struct {
+        int32_t passo_mC;
+        tendencia_t esperada;
+    } trechos[] = {
+        { 5, TENDENCIA_SUBINDO },   // Chega ao limiar de entrada
+        { 3, TENDENCIA_SUBINDO },   // 180 m°C/min: entre os limiares, continua
+        { 2, TENDENCIA_ESTÁVEL },   // 120 m°C/min: abaixo do de volta
+        { 3, TENDENCIA_ESTÁVEL },   // 180 m°C/min de novo: não basta para sair
+        { -5, TENDENCIA_CAINDO },
+        { -3, TENDENCIA_CAINDO },
+        { 0, TENDENCIA_ESTÁVEL },
+    };
+    const config_tendencia_t cfg_hist = { 4, 1000, 0, 300, 150 };
+    int32_t y = 25000;
+
+    tarefa3_configurar(&cfg_hist);
+    tarefa3_atualizar(y, NULL);
+    for (unsigned i = 0; i < count_of(trechos); i++) {
+        tendencia_t t = TENDENCIA_ESTÁVEL;
+        for (int k = 0; k < cfg_hist.janela; k++) {
+            y += trechos[i].passo_mC;
+            t = tarefa3_atualizar(y, &res);
+        }
+        CONFERIR(t == trechos[i].esperada, "trecho %u (%d m°C/amostra): %s, %d m°C/min", i,
+                 trechos[i].passo_mC, tendencia_para_texto(t), res.inclinacao_mC_min);
+    }
+
+}
+
+// === Framebuffer do OLED ===
+
+static uint8_t ssd[ssd1306_buffer_length];
+
+static uint32_t fnv1a(const uint8_t *dados, uint32_t n) {
+    uint32_t h = 2166136261u;
+    for (uint32_t i = 0; i < n; i++) h = (h ^ dados[i]) * 16777619u;
+    return h;
+}
+
+// Glifo desenhado pixel a pixel, como draw_big_char fazia antes do blit por páginas
+static void big_char_referencia(uint8_t *fb, int x, int y, const uint8_t *glifo) {
+    for (int p = 0; p < BIG_GLIFO_PAGINAS; p++) {
+        for (int c = 0; c < BIG_GLIFO_LARGURA; c++) {
+            uint8_t b = glifo[p * BIG_GLIFO_LARGURA + c];
+            for (int k = 0; k < 8; k++) {
+                int px = x + c, py = y + p * 8 + k;
+                if (px < 0 || px >= ssd1306_width || py < 0 || py >= ssd1306_height) continue;
+                ssd1306_set_pixel(fb, px, py, (b >> k) & 1);
+            }
+        }
+    }
+}
+
+static void testar_blit(void) {
+    static const int xs[] = { -5, 0, 40, 119 };
+    static const int ys[] = { -9, -3, 0, 3, 29, 32, 45, 60 };
+    static uint8_t ref[ssd1306_buffer_length];
+
+    for (unsigned i = 0; i < count_of(xs); i++) {
+        for (unsigned j = 0; j < count_of(ys); j++) {
+            // Fundo não vazio: o modo cópia tem que apagar o que está sob o glifo
+            for (int b = 0; b < ssd1306_buffer_length; b++) ssd[b] = (uint8_t)(b * 37);
+            memcpy(ref, ssd, sizeof(ref));
+
+            draw_big_char(ssd, xs[i], ys[j], big_digit_8_pag);
+            big_char_referencia(ref, xs[i], ys[j], big_digit_8_pag);
+            CONFERIR(memcmp(ssd, ref, sizeof(ref)) == 0, "blit difere em x=%d y=%d", xs[i], ys[j]);
+        }
+    }
+}
+
+// Checksums do framebuffer com o valor desenhado por mostrar_valor_grande()
+static const struct {
+    int32_t mC;
+    int y;
+    uint32_t fnv;
+} quadros_esperados[] = {
+    { 25300,  32, 0xab4da1eau },
+    { -12300, 32, 0xc52aff0au },
+    { 0,      32, 0x7ae1b5b5u },
+    { 99900,  32, 0xa6ac2862u },
+    { 25300,  29, 0x32c7ecd9u },
+    { -8600,   5, 0x5bce29b6u },
+};
+
+static void testar_checksums(void) {
+    for (unsigned i = 0; i < count_of(quadros_esperados); i++) {
+        memset(ssd, 0, sizeof(ssd));
+        mostrar_valor_grande(ssd, quadros_esperados[i].mC, quadros_esperados[i].y);
+        uint32_t h = fnv1a(ssd, sizeof(ssd));
+        CONFERIR(h == quadros_esperados[i].fnv, "%d m°C em y=%d: fnv 0x%08xu, esperado 0x%08xu",
+                 (int)quadros_esperados[i].mC, quadros_esperados[i].y, h, quadros_esperados[i].fnv);
+    }
+}
+
+// formatar_fixo() contra o snprintf do host, que arredonda o meio para o par: os
+// valores com meio exato e os que arredondam para "-0" ficam de fora da comparação
+static void testar_formatacao(void) {
+    static const struct {
+        int32_t valor;
+        uint8_t casas_valor, casas;
+        bool sinal;
+        const char *texto;
+    } casos[] = {
+        { 25340,        3, 1, true,  "+25.3" },
+        { 25350,        3, 1, true,  "+25.4" },
+        { -25350,       3, 1, true,  "-25.4" },
+        { -49,          3, 1, true,  "+0.0" },
+        { -50,          3, 1, false, "-0.1" },
+        { 0,            3, 0, false, "0" },
+        { 999950,       3, 1, false, "1000.0" },
+        { 7,            3, 3, false, "0.007" },
+        { -7,           6, 6, true,  "-0.000007" },
+        { 123,          0, 0, true,  "+123" },
+        { INT32_MAX,    3, 3, false, "2147483.647" },
+        { INT32_MIN,    3, 3, true,  "-2147483.648" },
+        { INT32_MIN,    9, 9, false, "-2.147483648" },
+        { INT32_MIN,    9, 0, false, "-2" },
+    };
+    char buf[FORMATACAO_TAM_MAX];
+    for (unsigned i = 0; i < count_of(casos); i++) {
+        uint8_t n = formatar_fixo(buf, casos[i].valor, casos[i].casas_valor, casos[i].casas, casos[i].sinal);
+        CONFERIR(strcmp(buf, casos[i].texto) == 0 && n == strlen(casos[i].texto),
+                 "%d (%u/%u casas): \"%s\", esperado \"%s\"", (int)casos[i].valor,
+                 casos[i].casas_valor, casos[i].casas, buf, casos[i].texto);
+    }
+
+    // Varredura de m°C em todas as precisões
+    char ref[32];
+    unsigned diferentes = 0;
+    for (int32_t mC = -130000; mC <= 130000; mC += 7) {
+        for (uint8_t casas = 0; casas <= 3; casas++) {
+            int32_t passo = casas == 3 ? 1 : casas == 2 ? 10 : casas == 1 ? 100 : 1000;
+            int32_t resto = mC % passo;
+            if (passo > 1 && (resto == passo / 2 || resto == -passo / 2)) continue;
+            if (mC < 0 && -mC < passo / 2) continue;
+            formatar_mC(buf, mC, casas, true);
+            snprintf(ref, sizeof(ref), "%+.*f", casas, mC / 1000.0);
+            if (strcmp(buf, ref) != 0 && diferentes++ < 4) {
+                CONFERIR(false, "%d m°C com %u casas: \"%s\", snprintf \"%s\"", (int)mC, casas, buf, ref);
+            }
+        }
+    }
+    CONFERIR(diferentes == 0, "%u valores diferem do snprintf", diferentes);
+}
+
+static int concluidos = 0;
+
+static void ao_concluir(void) {
+    concluidos++;
+}
+
+// Confere um envio pelo barramento: janela de endereçamento numa transação e, para
+// cada página, outra com o controle 0x40 e as colunas da janela, todas terminadas em STOP
+static void conferir_envio_janela(const char *caso, uint32_t bytes_esperados) {
+    const uint16_t *w;
+    uint32_t n = mock_i2c_palavras(&w);
+
+    CONFERIR(n > 7, "%s: %u palavras", caso, n);
+    if (n <= 7) return;
+
+    CONFERIR(w[0] == 0x00 && w[1] == ssd1306_set_column_address && w[4] == ssd1306_set_page_address,
+             "%s: janela de enderecamento", caso);
+    CONFERIR(w[6] & I2C_IC_DATA_CMD_STOP_BITS, "%s: janela sem STOP", caso);
+
+    int pag_ini = w[5], pag_fim = w[6] & 0xFF;
+    uint32_t paginas = (uint32_t)(pag_fim - pag_ini + 1);
+    CONFERIR(n == 7 + paginas + bytes_esperados, "%s: %u palavras, esperadas %u", caso, n,
+             7 + paginas + bytes_esperados);
+    if (n != 7 + paginas + bytes_esperados) return;
+
+    uint32_t k = 7;
+    for (int p = pag_ini; p <= pag_fim; p++) {
+        CONFERIR(w[k] == 0x40, "%s: pagina %d sem controle de dados", caso, p);
+        k++;
+        for (int c = w[2]; c <= w[3]; c++) {
+            CONFERIR((w[k] & 0xFF) == ssd[p * ssd1306_width + c], "%s: byte (%d,%d)", caso, c, p);
+            CONFERIR(!(w[k] & I2C_IC_DATA_CMD_STOP_BITS) == (c < w[3]), "%s: STOP em (%d,%d)", caso, c, p);
+            k++;
+        }
+    }
+}
+
+static void testar_flush(void) {
+    const uint16_t *w;
+    uint32_t enviados, iguais;
+
+    mock_i2c_limpar();
+    ssd1306_init();
+    uint32_t n = mock_i2c_palavras(&w);
+    CONFERIR(n > 1 && w[0] == 0x00 && (w[n - 1] & I2C_IC_DATA_CMD_STOP_BITS) && (w[n - 1] & 0xFF) == 0xAF,
+             "init: %u palavras numa transacao terminada em display on", n);
+
+    // Painel desconhecido após o init: o primeiro envio é o quadro inteiro
+    memset(ssd, 0, sizeof(ssd));
+    mostrar_valor_grande(ssd, 25300, 32);
+    mock_i2c_limpar();
+    CONFERIR(ssd1306_flush_alteracoes(ssd, ao_concluir), "flush recusado");
+    ssd1306_flush_aguardar();
+    conferir_envio_janela("quadro inteiro", ssd1306_buffer_length);
+
+    // Mesmo quadro: nada vai ao barramento, mas o callback é chamado
+    mock_i2c_limpar();
+    ssd1306_flush_alteracoes(ssd, ao_concluir);
+    CONFERIR(mock_i2c_palavras(&w) == 0, "quadro repetido foi enviado");
+
+    // Só o último dígito muda: 16 colunas x 4 páginas
+    memset(ssd, 0, sizeof(ssd));
+    mostrar_valor_grande(ssd, 25400, 32);
+    mock_i2c_limpar();
+    ssd1306_flush_alteracoes(ssd, ao_concluir);
+    ssd1306_flush_aguardar();
+    n = mock_i2c_palavras(&w);
+    CONFERIR(n > 8, "um digito: %u palavras", n);
+    if (n > 8) {
+        uint32_t largura = w[3] - w[2] + 1, paginas = (w[6] & 0xFF) - w[5] + 1;
+        CONFERIR(paginas <= BIG_GLIFO_PAGINAS && largura <= BIG_GLIFO_LARGURA,
+                 "um digito: janela de %ux%u", largura, paginas);
+        conferir_envio_janela("um digito", largura * paginas);
+    }
+
+    CONFERIR(concluidos == 3, "callback chamado %d vezes", concluidos);
+    ssd1306_estatisticas(&enviados, &iguais);
+    CONFERIR(enviados == 2 && iguais == 1, "estatisticas %u enviados, %u iguais", enviados, iguais);
+
+    // NACK no meio: a cópia do painel deixa de valer e o próximo envio é completo
+    uint32_t erros = ssd1306_flush_erros();
+    mock_i2c_abortar();
+    memset(ssd, 0, sizeof(ssd));
+    mostrar_valor_grande(ssd, 25500, 32);
+    ssd1306_flush_alteracoes(ssd, NULL);
+    ssd1306_flush_aguardar();
+    CONFERIR(ssd1306_flush_erros() == erros + 1, "aborto nao contado");
+
+    mock_i2c_limpar_aborto();
+    mock_i2c_limpar();
+    ssd1306_flush_alteracoes(ssd, NULL);
+    ssd1306_flush_aguardar();
+    conferir_envio_janela("apos aborto", ssd1306_buffer_length);
+}
+
+// === Gráfico do OLED ===
+
+// Envia tudo o que o gráfico tem pendente e devolve quantas colunas foram
+static uint32_t drenar_grafico(void) {
+    uint32_t antes, depois, r;
+    grafico_estatisticas(&antes, &r);
+    while (grafico_pendente()) {
+        grafico_poll();
+        ssd1306_flush_aguardar();
+    }
+    grafico_estatisticas(&depois, &r);
+    return depois - antes;
+}
+
+static void testar_grafico(void) {
+    const uint16_t *w;
+    uint32_t enviadas, reescalas;
+
+    memset(ssd, 0, sizeof(ssd));
+    ssd1306_flush_alteracoes(ssd, NULL);
+    ssd1306_flush_aguardar();
+    grafico_iniciar(ssd);
+    CONFERIR(drenar_grafico() == GRAFICO_COLUNAS, "inicio: area do grafico nao limpa");
+
+    // Primeira amostra fixa a escala: redesenho completo
+    grafico_adicionar(25000);
+    CONFERIR(drenar_grafico() == GRAFICO_COLUNAS, "primeira escala sem redesenho completo");
+
+    // Dentro da escala: só a coluna nova e o cursor, 2 colunas x 3 páginas
+    grafico_adicionar(25100);
+    mock_i2c_limpar();
+    grafico_poll();
+    ssd1306_flush_aguardar();
+    conferir_envio_janela("grafico", 2 * GRAFICO_PAGINAS);
+    if (mock_i2c_palavras(&w) > 8) {
+        CONFERIR(w[2] == 1 && w[3] == 2 && w[5] == GRAFICO_PAGINA_INI &&
+                 (w[6] & 0xFF) == GRAFICO_PAGINA_INI + GRAFICO_PAGINAS - 1,
+                 "grafico: janela col %u..%u pag %u..%u", w[2], w[3], w[5], w[6] & 0xFF);
+    }
+
+    // A cópia do painel acompanhou: a Tarefa 2 não reenvia as colunas
+    mock_i2c_limpar();
+    ssd1306_flush_alteracoes(ssd, NULL);
+    CONFERIR(mock_i2c_palavras(&w) == 0, "colunas do grafico reenviadas pelo flush");
+
+    // Passeio aleatório com volta no anel: a escala cobre sempre a janela visível
+    int32_t visiveis[3 * GRAFICO_COLUNAS];
+    int n = 0, erros_escala = 0, erros_pixel = 0;
+    int32_t v = 25100;
+    visiveis[n++] = 25000;
+    visiveis[n++] = 25100;
+    srand(7);
+    for (int i = 0; i < 3 * GRAFICO_COLUNAS - 2; i++) {
+        v += (rand() % 121) - 60;
+        grafico_adicionar(v);
+        visiveis[n++] = v;
+
+        int32_t vmin = INT32_MAX, vmax = INT32_MIN, lo, hi;
+        for (int k = n > GRAFICO_COLUNAS - 1 ? n - (GRAFICO_COLUNAS - 1) : 0; k < n; k++) {
+            if (visiveis[k] < vmin) vmin = visiveis[k];
+            if (visiveis[k] > vmax) vmax = visiveis[k];
+        }
+        grafico_escala(&lo, &hi);
+        if (lo > vmin || hi < vmax || hi - lo < GRAFICO_FAIXA_MIN_MC ||
+            lo % GRAFICO_PASSO_MC || hi % GRAFICO_PASSO_MC) {
+            erros_escala++;
+        }
+
+        int col = (n - 1) % GRAFICO_COLUNAS;
+        int y = (GRAFICO_ALTURA - 1) - (int)((int64_t)(v - lo) * (GRAFICO_ALTURA - 1) / (hi - lo));
+        y += GRAFICO_PAGINA_INI * 8;
+        if (!(ssd[(y / 8) * ssd1306_width + col] & (1u << (y % 8)))) erros_pixel++;
+        int cursor = (col + 1) % GRAFICO_COLUNAS;
+        for (int p = 0; p < GRAFICO_PAGINAS; p++) {
+            if (ssd[(GRAFICO_PAGINA_INI + p) * ssd1306_width + cursor]) erros_pixel++;
+        }
+        drenar_grafico();
+    }
+    CONFERIR(erros_escala == 0, "escala fora da janela visivel em %d amostras", erros_escala);
+    CONFERIR(erros_pixel == 0, "%d pixels errados (amostra ou cursor)", erros_pixel);
+
+    // Degrau fora da escala: nova escala e o quadro inteiro do gráfico vai ao painel
+    grafico_estatisticas(&enviadas, &reescalas);
+    uint32_t r0 = reescalas;
+    grafico_adicionar(v + 20000);
+    grafico_estatisticas(&enviadas, &reescalas);
+    CONFERIR(reescalas == r0 + 1, "degrau sem reescala");
+    CONFERIR(drenar_grafico() == GRAFICO_COLUNAS, "reescala sem redesenho completo");
+
+    printf("# grafico: %u reescalas em %d amostras\n", reescalas, n + 1);
+}
+
+// === Barramento i2c ===
+
+static int leituras_ok, leituras_falhas;
+
+static void ao_ler(transacao_i2c_t *t, bool ok) {
+    (void)t;
+    if (ok) leituras_ok++; else leituras_falhas++;
+}
+
+static void testar_barramento_i2c(void) {
+    const uint16_t *w;
+    static const uint8_t registrador = 0x05;
+    static const uint8_t resposta[] = { 0x1A, 0x2B };
+    uint16_t palavras[3];
+    uint8_t lidos[2] = { 0 };
+    estatisticas_i2c_t e0, e;
+
+    transacao_i2c_t leitura = {
+        .endereco = 0x18,
+        .prioridade = I2C_PRIORIDADE_ALTA,
+        .palavras = palavras,
+        .n_palavras = barramento_i2c_montar(palavras, &registrador, 1, sizeof(lidos)),
+        .leitura = lidos,
+        .n_leitura = sizeof(lidos),
+        .concluida = ao_ler,
+    };
+    CONFERIR(leitura.n_palavras == 3 && palavras[0] == registrador &&
+             palavras[1] == (I2C_IC_DATA_CMD_CMD_BITS | I2C_IC_DATA_CMD_RESTART_BITS) &&
+             palavras[2] == (I2C_IC_DATA_CMD_CMD_BITS | I2C_IC_DATA_CMD_STOP_BITS),
+             "montar: palavras %03x %03x %03x", palavras[0], palavras[1], palavras[2]);
+
+    // Quadro inteiro na fila baixa; a leitura chega logo depois da janela de endereçamento
+    barramento_i2c_estatisticas(&e0);
+    memset(ssd, 0, sizeof(ssd));
+    mostrar_valor_grande(ssd, 12300, 32);
+    ssd1306_init();
+    barramento_i2c_poll();   // O init não espera o barramento
+    mock_i2c_limpar();
+    mock_i2c_responder(resposta, sizeof(resposta));
+    CONFERIR(ssd1306_flush_alteracoes(ssd, NULL), "flush recusado");
+    CONFERIR(barramento_i2c_submeter(&leitura), "leitura recusada");
+    CONFERIR(!barramento_i2c_submeter(&leitura), "leitura pendente aceita de novo");
+    ssd1306_flush_aguardar();
+    barramento_i2c_poll();
+
+    uint32_t n = mock_i2c_palavras(&w);
+    CONFERIR(n == 7 + 3 + ssd1306_n_pages * (1 + ssd1306_width), "%u palavras", n);
+    if (n > 10) {
+        CONFERIR(w[7] == registrador && (w[8] & I2C_IC_DATA_CMD_CMD_BITS) && (w[9] & I2C_IC_DATA_CMD_STOP_BITS)
+                 && w[10] == 0x40, "leitura nao entrou entre a janela e a primeira pagina");
+    }
+    CONFERIR(!leitura.pendente && leitura.ok && leituras_ok == 1, "leitura nao concluida");
+    CONFERIR(lidos[0] == resposta[0] && lidos[1] == resposta[1], "bytes lidos %02x %02x", lidos[0], lidos[1]);
+
+    // NACK: a leitura falha, o motor segue para a próxima sem travar
+    mock_i2c_abortar();
+    barramento_i2c_submeter(&leitura);
+    barramento_i2c_poll();
+    mock_i2c_limpar_aborto();
+    CONFERIR(!leitura.pendente && !leitura.ok && leituras_falhas == 1, "aborto nao entregue ao cliente");
+    CONFERIR(barramento_i2c_executar(&leitura) && leituras_ok == 2, "barramento preso apos o aborto");
+    CONFERIR(!barramento_i2c_ocupado(), "barramento ocupado depois de tudo concluido");
+
+    barramento_i2c_estatisticas(&e);
+    CONFERIR(e.concluidas[I2C_PRIORIDADE_ALTA] - e0.concluidas[I2C_PRIORIDADE_ALTA] == 2 &&
+             e.abortadas[I2C_PRIORIDADE_ALTA] - e0.abortadas[I2C_PRIORIDADE_ALTA] == 1 &&
+             e.concluidas[I2C_PRIORIDADE_BAIXA] - e0.concluidas[I2C_PRIORIDADE_BAIXA] == 2 + ssd1306_n_pages,
+             "estatisticas: alta %u/%u, baixa %u", e.concluidas[0], e.abortadas[0], e.concluidas[1]);
+}
+
+// === Boot ===
+
+static int chamadas_boot[2];
+
+static void etapa_a(void) { chamadas_boot[0]++; }
+static void etapa_b(void) { chamadas_boot[1]++; sleep_us(2000); }
+
+static void testar_boot(void) {
+    static const etapa_boot_t etapas[] = { { "a", etapa_a }, { "b", etapa_b } };
+    estatisticas_boot_t e;
+
+    CONFERIR(boot_executar(etapas, count_of(etapas)), "boot recusado na primeira chamada");
+    CONFERIR(!boot_executar(etapas, count_of(etapas)), "segundo boot aceito");
+    CONFERIR(chamadas_boot[0] == 1 && chamadas_boot[1] == 1, "etapas rodaram %d e %d vezes",
+             chamadas_boot[0], chamadas_boot[1]);
+
+    boot_estatisticas(&e);
+    CONFERIR(e.n_etapas == 2 && e.duracao_us[1] >= 2000 && e.fim_us >= e.inicio_us + e.duracao_us[1],
+             "duracoes %u e %u us", e.duracao_us[0], e.duracao_us[1]);
+    CONFERIR(e.primeira_amostra_us == 0, "primeira amostra antes da marca");
+
+    boot_primeira_amostra();
+    boot_estatisticas(&e);
+    uint64_t primeira = e.primeira_amostra_us;
+    sleep_us(100);
+    boot_primeira_amostra();
+    boot_estatisticas(&e);
+    CONFERIR(primeira >= e.fim_us && e.primeira_amostra_us == primeira, "primeira amostra remarcada");
+}
+
+// === NeoPixel ===
+
+static void aguardar_fio_np(void) {
+    while (!npQuadroConcluido()) npPoll();
+}
+
+static uint8_t gama_referencia(uint v, uint brilho) {
+    long g = lround(255.0 * pow(v / 255.0, 2.2));
+    return (uint8_t)((g * brilho + 127) / 255);
+}
+
+static void testar_neopixel(void) {
+    const uint32_t *w;
+    uint32_t enviados, ignorados, enviados0, ignorados0;
+
+    npInit(LED_PIN);
+    aguardar_fio_np();
+    mock_pio_limpar();
+    npEstatisticas(&enviados0, &ignorados0);
+
+    // Cada quadro leva LED_COUNT níveis diferentes em R, G e B
+    static const uint brilhos[] = { 255, 128 };
+    for (unsigned b = 0; b < count_of(brilhos); b++) {
+        npDefinirBrilho((uint8_t)brilhos[b]);
+        for (uint base = 0; base < 256; base += LED_COUNT) {
+            for (uint i = 0; i < LED_COUNT; i++) {
+                uint v = (base + i) & 0xFF;
+                npSetLED(i, v, 255 - v, v / 2);
+            }
+            mock_pio_limpar();
+            npWriteAsync();
+            aguardar_fio_np();
+
+            CONFERIR(mock_pio_palavras(0, &w) == LED_COUNT, "quadro com %u palavras", mock_pio_palavras(0, &w));
+            for (uint i = 0; i < LED_COUNT; i++) {
+                uint v = (base + i) & 0xFF;
+                uint32_t esperado = ((uint32_t)gama_referencia(255 - v, brilhos[b]) << 24) |
+                                    ((uint32_t)gama_referencia(v, brilhos[b]) << 16) |
+                                    ((uint32_t)gama_referencia(v / 2, brilhos[b]) << 8);
+                CONFERIR(w[i] == esperado, "LED %u nivel %u brilho %u: 0x%08x, esperado 0x%08x",
+                         i, v, brilhos[b], w[i], esperado);
+            }
+        }
+    }
+
+    // Quadro idêntico ao último não toca no fio
+    mock_pio_limpar();
+    npWriteAsync();
+    aguardar_fio_np();
+    CONFERIR(mock_pio_palavras(0, &w) == 0, "quadro repetido foi enviado");
+    npEstatisticas(&enviados, &ignorados);
+    CONFERIR(ignorados == ignorados0 + 1, "ignorados %u", ignorados - ignorados0);
+    npDefinirBrilho(NP_BRILHO_PADRAO);
+}
+
+// === Histórico em flash ===
+
+#define HIST_PRIMEIRO_SETOR ((PICO_FLASH_SIZE_BYTES / FLASH_SECTOR_SIZE) - HISTORICO_SETORES)
+
+static uint32_t k_hist = 0;   // Índice do próximo registro; timestamp = k × 2 s
+
+static int32_t temp_hist(uint32_t k) {
+    return 22500 + (int32_t)((k * 37u) % 5000u) - (int32_t)((k * 11u) % 3000u);
+}
+
+// 'n' registros (cada um a média de janelas iguais), com a flash sempre livre
+static void registrar_hist(uint32_t n) {
+    for (uint32_t i = 0; i < n; i++, k_hist++) {
+        for (uint32_t j = 0; j < HISTORICO_JANELAS_POR_REGISTRO; j++) {
+            historico_registrar(temp_hist(k_hist), k_hist * 2000u);
+        }
+        historico_servico(UINT32_MAX);
+    }
+}
+
+static void drenar_hist(void) {
+    for (uint32_t i = 0; i < FLASH_SECTOR_SIZE / FLASH_PAGE_SIZE + 1; i++) historico_servico(UINT32_MAX);
+}
+
+static uint32_t seq_hist(void) {
+    estatisticas_historico_t e;
+    historico_estatisticas(&e);
+    return e.seq_proximo;
+}
+
+// Avança até 'seq' setores fechados, todos já na flash
+static void fechar_setores_ate(uint32_t seq) {
+    while (seq_hist() < seq) registrar_hist(1);
+    drenar_hist();
+}
+
+typedef struct {
+    uint32_t n;
+    uint32_t k_primeiro, k_ultimo;
+    uint32_t erros;
+} visita_hist_t;
+
+static bool visitar_hist(const registro_historico_t *r, void *ctx) {
+    visita_hist_t *v = ctx;
+    uint32_t k = r->timestamp_ms / 2000u;
+    if (v->n == 0) {
+        v->k_primeiro = k;
+    } else if (k != v->k_ultimo + 1) {
+        v->erros++;
+    }
+    if (r->temp_mC != temp_hist(k) || r->timestamp_ms % 2000u) v->erros++;
+    v->k_ultimo = k;
+    v->n++;
+    return true;
+}
+
+static visita_hist_t percorrer_hist(void) {
+    visita_hist_t v = { 0 };
+    CONFERIR(historico_percorrer(0, visitar_hist, &v) == v.n, "percorrer: contagem devolvida difere");
+    return v;
+}
+
+static void testar_historico(void) {
+    estatisticas_historico_t e;
+
+    mock_flash_apagar_tudo();
+    historico_iniciar();
+    historico_estatisticas(&e);
+    CONFERIR(e.ativo && e.seq_proximo == 0 && e.boot == 0, "flash vazia: seq %u boot %u", e.seq_proximo, e.boot);
+
+    // Folga curta não apaga nada
+    registrar_hist(10);
+    CONFERIR(historico_descarregar(), "descarregar com a fila livre");
+    historico_servico(HISTORICO_FOLGA_APAGAR_US - 1);
+    CONFERIR(mock_flash_apagamentos(HIST_PRIMEIRO_SETOR) == 0, "apagou sem folga");
+
+    // flash_safe_execute recusado: conta e tenta de novo
+    mock_flash_recusar(2);
+    drenar_hist();
+    drenar_hist();
+    historico_estatisticas(&e);
+    CONFERIR(e.falhas_flash == 2 && e.setores_gravados == 1, "recusas: falhas %u, setores %u",
+             e.falhas_flash, e.setores_gravados);
+
+    // Mais de duas voltas no anel; o desgaste fica igual entre os setores
+    fechar_setores_ate(2 * HISTORICO_SETORES + HISTORICO_SETORES / 2);
+    historico_estatisticas(&e);
+    CONFERIR(e.registros_perdidos == 0, "%u registros perdidos com a flash livre", e.registros_perdidos);
+    uint32_t menor = UINT32_MAX, maior = 0;
+    for (uint32_t i = 0; i < HISTORICO_SETORES; i++) {
+        uint32_t a = mock_flash_apagamentos(HIST_PRIMEIRO_SETOR + i);
+        if (a < menor) menor = a;
+        if (a > maior) maior = a;
+    }
+    CONFERIR(maior - menor <= 1 && menor >= 2, "desgaste desigual: %u..%u apagamentos", menor, maior);
+    CONFERIR(mock_flash_apagamentos(HIST_PRIMEIRO_SETOR - 1) == 0, "apagou fora da região");
+
+    // Os registros voltam em ordem, sem buracos, até o que ainda está em RAM
+    registrar_hist(5);
+    visita_hist_t v = percorrer_hist();
+    CONFERIR(v.erros == 0 && v.k_ultimo == k_hist - 1, "percorrer: %u erros, ultimo %u de %u",
+             v.erros, v.k_ultimo, k_hist - 1);
+    visita_hist_t um = { 0 };
+    historico_percorrer(1, visitar_hist, &um);
+    CONFERIR(um.n > 5 && um.n < v.n, "percorrer(1): %u registros", um.n);
+
+    // Boot: acha o mais recente lendo poucos cabeçalhos
+    uint32_t seq = seq_hist();
+    historico_iniciar();
+    historico_estatisticas(&e);
+    CONFERIR(e.seq_proximo == seq && e.boot == 1, "boot: seq %u (esperado %u), boot %u", e.seq_proximo, seq, e.boot);
+    CONFERIR(e.leituras_indice <= 6, "boot leu %u cabecalhos", e.leituras_indice);
+    v = percorrer_hist();
+    CONFERIR(v.erros == 0 && v.k_primeiro > 0, "apos boot: %u erros", v.erros);
+
+    // Queda de energia com o setor apagado e só parte das páginas gravadas
+    k_hist = v.k_ultimo + 1;
+    registrar_hist(600);
+    historico_descarregar();
+    mock_flash_cortar_apos(3);
+    drenar_hist();
+    mock_flash_religar();
+    historico_iniciar();
+    CONFERIR(seq_hist() == seq, "setor sem cabecalho aceito: seq %u, esperado %u", seq_hist(), seq);
+    v = percorrer_hist();
+    CONFERIR(v.erros == 0, "apos queda: %u erros", v.erros);
+
+    // Queda logo depois de apagar a posição 0: o mais novo é o da última posição
+    k_hist = v.k_ultimo + 1;
+    fechar_setores_ate((seq / HISTORICO_SETORES + 1) * HISTORICO_SETORES);
+    seq = seq_hist();
+    registrar_hist(10);
+    historico_descarregar();
+    mock_flash_cortar_apos(1);
+    drenar_hist();
+    mock_flash_religar();
+    historico_iniciar();
+    CONFERIR(seq_hist() == seq, "posicao 0 apagada: seq %u, esperado %u", seq_hist(), seq);
+    v = percorrer_hist();
+    CONFERIR(v.erros == 0 && v.n > 0, "posicao 0 apagada: %u erros, %u registros", v.erros, v.n);
+}
+
+// === Supervisor ===
+
+static void testar_supervisor(void) {
+    supervisor_iniciar();
+    CONFERIR(!supervisor_causa_anterior()->por_watchdog, "boot normal visto como reset");
+
+    uint8_t rapida = supervisor_registrar("rapida", 20);
+    uint8_t lenta = supervisor_registrar("lenta", 20);
+    CONFERIR(supervisor_registrar("rapida", 20) == rapida && rapida != lenta, "ids do registro");
+
+    // Antes de ativar confere, mas não alimenta
+    CONFERIR(supervisor_verificar() && mock_watchdog_alimentacoes() == 0, "alimentou desligado");
+    supervisor_ativar();
+    CONFERIR(mock_watchdog_habilitado(), "watchdog nao habilitado");
+    CONFERIR(supervisor_verificar() && mock_watchdog_alimentacoes() == 1, "nao alimentou com todos em dia");
+
+    // Só a rápida bate: depois do prazo a lenta trava a alimentação
+    supervisor_marcar(lenta);
+    for (int i = 0; i < 6; i++) {
+        sleep_ms(5);
+        supervisor_batida(rapida);
+    }
+    uint32_t antes = mock_watchdog_alimentacoes();
+    CONFERIR(!supervisor_verificar(), "fonte atrasada nao detectada");
+    CONFERIR(mock_watchdog_alimentacoes() == antes, "alimentou com fonte atrasada");
+    CONFERIR((watchdog_hw->scratch[2] & 0xFFu) == lenta && watchdog_hw->scratch[3] > 20 &&
+             watchdog_hw->scratch[1] == lenta,
+             "scratch: faltou %u, atraso %u, rodando %u", watchdog_hw->scratch[2] & 0xFFu,
+             watchdog_hw->scratch[3], watchdog_hw->scratch[1]);
+
+    // Enquanto atrasada, a causa gravada não muda; quando volta, some e a alimentação retorna
+    supervisor_batida(rapida);
+    CONFERIR(!supervisor_verificar() && (watchdog_hw->scratch[2] & 0xFFu) == lenta, "causa sobrescrita");
+    supervisor_batida(lenta);
+    CONFERIR(supervisor_verificar() && watchdog_hw->scratch[2] == SUPERVISOR_NENHUMA &&
+             mock_watchdog_alimentacoes() == antes + 1, "nao voltou a alimentar");
+}
+
+// === Tópicos ===
+
+static void testar_topicos(void) {
+    static int32_t amostra;
+    static tendencia_t estado;
+    topico_t t_amostra = TOPICO("amostra", amostra);
+    topico_t t_estado = TOPICO("estado", estado);
+    int32_t lido = -1;
+
+    CONFERIR(topico_ler(&t_amostra, &lido) == 0 && lido == -1, "leitura antes da primeira publicacao");
+
+    // Toda publicação avança a versão, mesmo com o mesmo valor
+    int32_t v = 25000;
+    topico_publicar(&t_amostra, &v);
+    topico_publicar(&t_amostra, &v);
+    CONFERIR(topico_ler(&t_amostra, &lido) == 2 && lido == 25000, "versao %u, valor %d",
+             topico_versao(&t_amostra), lido);
+
+    // Assinante de mudança: a primeira publicação sempre vale, a repetida não
+    tendencia_t e = TENDENCIA_ESTÁVEL;
+    CONFERIR(topico_publicar_se_mudou(&t_estado, &e), "primeiro estado nao publicado");
+    CONFERIR(!topico_publicar_se_mudou(&t_estado, &e) && topico_versao(&t_estado) == 1, "estado repetido publicado");
+    e = TENDENCIA_SUBINDO;
+    CONFERIR(topico_publicar_se_mudou(&t_estado, &e) && estado == TENDENCIA_SUBINDO, "mudanca nao publicada");
+}
+
+// === Parâmetros ===
+
+static uint16_t par_bloco;
+static int32_t par_limiar;
+static bool par_sono;
+static int aplicacoes;
+
+static bool par_aplicar(void) {
+    aplicacoes++;
+    return par_limiar != 13;   // 13 é recusado pelo "módulo"
+}
+
+static const parametro_t par_tabela[] = {
+    { "t.bloco",  PARAM_U16,  &par_bloco,  2, 256, NULL, "" },
+    { "t.limiar", PARAM_I32,  &par_limiar, -500, 500, par_aplicar, "" },
+    { "t.sono",   PARAM_BOOL, &par_sono,   0, 1, NULL, "" },
+};
+
+static void par_padroes(void) {
+    par_bloco = 256;
+    par_limiar = 300;
+    par_sono = false;
+}
+
+static void testar_parametros(void) {
+    CONFERIR(parametros_apagar() && parametros_carregar() == 0, "setor apagado ainda valido");
+    par_padroes();
+    CONFERIR(parametros_registrar(par_tabela, count_of(par_tabela)), "registro recusado");
+    CONFERIR(par_bloco == 256 && par_limiar == 300, "registro sem nada salvo mudou os valores");
+
+    CONFERIR(parametros_definir("t.bloco", "0x40") == PARAM_OK && par_bloco == 64, "set hex: %u", par_bloco);
+    CONFERIR(parametros_definir("t.limiar", "-150") == PARAM_OK && par_limiar == -150 && aplicacoes == 1,
+             "set negativo: %d (%d aplicacoes)", par_limiar, aplicacoes);
+    CONFERIR(parametros_definir("t.bloco", "12x") == PARAM_INVALIDO, "texto invalido aceito");
+    CONFERIR(parametros_definir("t.bloco", "1000") == PARAM_FORA_DA_FAIXA && par_bloco == 64, "faixa");
+    CONFERIR(parametros_definir("t.nada", "1") == PARAM_DESCONHECIDO, "nome desconhecido aceito");
+    CONFERIR(parametros_definir("t.limiar", "13") == PARAM_RECUSADO && par_limiar == -150,
+             "recusa nao restaurou: %d", par_limiar);
+    CONFERIR(parametros_definir("t.sono", "1") == PARAM_OK && par_sono, "bool");
+
+    // "Reboot": os padrões voltam e o registro traz os valores salvos
+    CONFERIR(parametros_salvar(), "salvar falhou");
+    par_padroes();
+    CONFERIR(parametros_carregar() == count_of(par_tabela), "carga: %u valores", parametros_carregar());
+    parametros_registrar(par_tabela, count_of(par_tabela));
+    CONFERIR(par_bloco == 64 && par_limiar == -150 && par_sono, "valores salvos nao voltaram");
+
+    // Faixa nova mais estreita: o valor salvo fora dela fica no padrão
+    static const parametro_t estreita[] = { { "t.limiar", PARAM_I32, &par_limiar, 0, 500, NULL, "" } };
+    par_limiar = 300;
+    parametros_registrar(estreita, 1);
+    CONFERIR(par_limiar == 300, "valor salvo fora da faixa nova aplicado");
+
+    // Setor corrompido é ignorado inteiro
+    const uint32_t offset = PICO_FLASH_SIZE_BYTES - (HISTORICO_SETORES + 1u) * FLASH_SECTOR_SIZE;
+    mock_flash[offset + sizeof(uint32_t) * 4] ^= 0x01;
+    CONFERIR(parametros_carregar() == 0, "setor corrompido aceito");
+    CONFERIR(mock_flash_apagamentos(offset / FLASH_SECTOR_SIZE) == 2, "apagamentos %u",
+             mock_flash_apagamentos(offset / FLASH_SECTOR_SIZE));
+}
+
+static void testar_animacao(void) {
+    const uint32_t *w;
+    const anim_efeito_t base = { ANIM_SOLIDO, 64, 0, 0, 100, true };
+    const anim_efeito_t alerta = { ANIM_PISCA, 64, 64, 64, 100, true };
+    const uint32_t vermelho = (uint32_t)gama_referencia(64, 255) << 16;
+    const uint32_t branco = vermelho | (vermelho << 8) | (vermelho >> 8);
+
+    uint32_t t = to_ms_since_boot(get_absolute_time()) + ANIM_QUADRO_MIN_MS;
+    anim_iniciar(ANIM_CAMADA_BASE, &base, 0);
+    anim_iniciar(ANIM_CAMADA_ALERTA, &alerta, 0);
+
+    // Passo 0 do pisca: o alerta cobre a base; passo 1: apagado, a base aparece
+    uint32_t cores[2];
+    for (int k = 0; k < 2; k++) {
+        aguardar_fio_np();
+        mock_pio_limpar();
+        CONFERIR(efeito_tick(t + k * 100), "passo %d sem quadro", k);
+        aguardar_fio_np();
+        CONFERIR(mock_pio_palavras(0, &w) == LED_COUNT, "passo %d: %u palavras", k, mock_pio_palavras(0, &w));
+        cores[k] = w[0];
+        for (uint i = 1; i < LED_COUNT; i++) {
+            CONFERIR(w[i] == w[0], "passo %d: LED %u diferente", k, i);
+        }
+    }
+    CONFERIR(cores[0] == branco && cores[1] == vermelho, "composicao 0x%08x 0x%08x", cores[0], cores[1]);
+
+    // Sem passo vencido nada é enviado
+    CONFERIR(!efeito_tick(t + 100 + ANIM_QUADRO_MIN_MS), "quadro sem mudanca");
+
+    anim_parar(ANIM_CAMADA_ALERTA);
+    anim_parar(ANIM_CAMADA_BASE);
+    efeito_tick(t + 1000);
+}
+
+// === Desempenho ===
+
+typedef void (*caso_fn_t)(void);
+
+static int64_t agora_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static volatile int32_t sorvedouro;   // Os casos do host escrevem aqui (ver bench_sorvedouro no alvo)
+static uint16_t amostras_bench[BLOCO];
+
+static void caso_reducao_1(void) {
+    reducao_bloco_t r;
+    reducao_bloco(amostras_bench, BLOCO, 1, 0, &r);
+    sorvedouro = r.soma[0];
+}
+
+static void caso_reducao_hist(void) {
+    static reducao_hist_t hist;
+    reducao_bloco_t r;
+    reducao_hist_iniciar(&hist, amostras_bench[0]);
+    reducao_bloco_hist(amostras_bench, BLOCO, 1, 0, &hist, 0, &r);
+    sorvedouro = r.soma_q[0];
+}
+
+static void caso_reducao_5(void) {
+    reducao_bloco_t r;
+    sorvedouro = reducao_bloco(amostras_bench, BLOCO, ADC_NUM_CANAIS, 0, &r);
+}
+
+static void caso_conv_janela(void) {
+    uint64_t soma = 0;
+    for (int i = 0; i < BLOCO; i++) soma += amostras_bench[i];
+    sorvedouro = reducao_media_mC(&calib, soma, BLOCO);
+}
+
+static void caso_tendencia(void) {
+    static int n = 0;
+    sorvedouro = tarefa3_analisa_tendencia(25.0f + (n++ % 7) * 0.01f);
+}
+
+static void janela_tendencia_4(void) {
+    const config_tendencia_t c = { 4, 1500, 1, 300, 150 };
+    tarefa3_configurar(&c);
+}
+
+static void janela_tendencia_64(void) {
+    const config_tendencia_t c = { TENDENCIA_JANELA_MAX, 1500, 1, 300, 150 };
+    tarefa3_configurar(&c);
+}
+
+static void caso_big_char(void) {
+    draw_big_char(ssd, 40, 29, big_digit_8_pag);
+}
+
+static void caso_valor_grande(void) {
+    mostrar_valor_grande(ssd, -12300, 32);
+}
+
+static void caso_flush_digitos(void) {
+    static int n = 0;
+    memset(ssd, 0, sizeof(ssd));
+    mostrar_valor_grande(ssd, 20000 + (n++ % 10) * 100, 32);
+    mock_i2c_limpar();
+    ssd1306_flush_alteracoes(ssd, NULL);
+    ssd1306_flush_aguardar();
+}
+
+static void caso_flush_igual(void) {
+    ssd1306_flush_alteracoes(ssd, NULL);
+}
+
+static void caso_np_write_async(void) {
+    static bool claro = false;
+    claro = !claro;
+    npSetAll(claro ? 64 : 0, 0, 32);
+    mock_pio_limpar();
+    sorvedouro = npWriteAsync();
+}
+
+static void caso_efeito_tick(void) {
+    static uint32_t t = 0;
+    t += 1000;   // Sempre vencido: cada chamada desenha, compõe e empacota
+    mock_pio_limpar();
+    sorvedouro = efeito_tick(t);
+}
+
+// Limites em ns por iteração, folgados (~20x um laptop comum) para pegar só regressões de algoritmo
+static const struct {
+    const char *nome;
+    caso_fn_t preparar;   // Uma vez antes do caso (pode ser NULL)
+    caso_fn_t fn;
+    uint32_t iteracoes;
+    uint32_t limite_ns;
+} casos[] = {
+    { "reducao_1canal_256",        NULL, caso_reducao_1,      20000,  20000 },
+    { "reducao_hist_1canal_256",   NULL, caso_reducao_hist,   20000,  40000 },
+    { "reducao_5canais_256",       NULL, caso_reducao_5,      20000,  40000 },
+    { "conv_fixa_janela_256",      NULL, caso_conv_janela,    20000,  20000 },
+    { "tarefa3_tendencia_janela4", janela_tendencia_4, caso_tendencia, 20000, 2000 },
+    { "tarefa3_tendencia_janela64", janela_tendencia_64, caso_tendencia, 20000, 2000 },
+    { "draw_big_char_y29",         NULL, caso_big_char,       20000,  20000 },
+    { "mostrar_valor_grande",      NULL, caso_valor_grande,   20000, 100000 },
+    { "flush_alteracoes_digitos",  NULL, caso_flush_digitos,   5000, 200000 },
+    { "flush_alteracoes_igual",    NULL, caso_flush_igual,    20000,  40000 },
+    { "npWriteAsync",              NULL, caso_np_write_async, 20000,  40000 },
+    { "efeito_tick_espiral",       NULL, caso_efeito_tick,    20000, 100000 },
+};
+
+static void medir_desempenho(bool com_limites) {
+    for (int i = 0; i < BLOCO; i++) amostras_bench[i] = fluxo[i % n_fluxo];
+
+    const anim_efeito_t espiral = { ANIM_ESPIRAL, 64, 0, 0, 10, true };
+    anim_iniciar(ANIM_CAMADA_BASE, &espiral, 0);
+    memset(ssd, 0, sizeof(ssd));
+
+    printf("bench,iteracoes,ns_medio,ns_min,ns_max,limite_ns\n");
+    for (unsigned c = 0; c < count_of(casos); c++) {
+        int64_t total = 0, lo = INT64_MAX, hi = 0;
+        if (casos[c].preparar) casos[c].preparar();
+        casos[c].fn();   // Aquecimento
+        for (uint32_t i = 0; i < casos[c].iteracoes; i++) {
+            int64_t t0 = agora_ns();
+            casos[c].fn();
+            int64_t dt = agora_ns() - t0;
+            total += dt;
+            if (dt < lo) lo = dt;
+            if (dt > hi) hi = dt;
+        }
+        int64_t medio = total / casos[c].iteracoes;
+        printf("%s,%u,%lld,%lld,%lld,%u\n", casos[c].nome, casos[c].iteracoes,
+               (long long)medio, (long long)lo, (long long)hi, casos[c].limite_ns);
+        if (com_limites) {
+            CONFERIR(medio <= casos[c].limite_ns, "%s: %lld ns por iteracao, limite %u",
+                     casos[c].nome, (long long)medio, casos[c].limite_ns);
+        }
+    }
+
+    anim_parar(ANIM_CAMADA_BASE);
+}
+
+int main(int argc, char **argv) {
+    bool com_limites = true;
+    const char *captura = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--sem-limites") == 0) {
+            com_limites = false;
+        } else {
+            captura = argv[i];
+        }
+    }
+
+    if (captura) {
+        if (!carregar_captura(captura)) {
+            printf("captura sem amostras suficientes\n");
+            return 1;
+        }
+    } else {
+        gerar_fluxo_sintetico();
+    }
+    printf("# fluxo: %u amostras (%s)\n", n_fluxo, captura ? captura : "sintetico");
+
+    canal_dma = dma_claim_unused_channel(true);
+
+    testar_reducao_intercalada();
+    testar_estatisticas_robustas();
+    testar_aquisicao(captura == NULL);
+    testar_tendencia();
+    testar_blit();
+    testar_checksums();
+    testar_formatacao();
+    testar_flush();
+    testar_grafico();
+    testar_barramento_i2c();
+    testar_neopixel();
+    testar_animacao();
+    testar_historico();
+    testar_supervisor();
+    testar_parametros();
+    testar_topicos();
+    testar_boot();
+    medir_desempenho(com_limites);
+
+    printf(falhas ? "# %d falha(s)\n" : "# ok\n", falhas);
+    return falhas ? 1 : 0;
+}
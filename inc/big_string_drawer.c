@@ -1,24 +1,24 @@
-#include "font_big_logo.h"
+#include "font_big_paginas.h"
 #include "draw_big_char.h"
 #include <stddef.h>
 
 const uint8_t* get_big_bitmap(char c) {
     switch (c) {
-        case '0': return big_digit_0;
-        case '1': return big_digit_1;
-        case '2': return big_digit_2;
-        case '3': return big_digit_3;
-        case '4': return big_digit_4;
-        case '5': return big_digit_5;
-        case '6': return big_digit_6;
-        case '7': return big_digit_7;
-        case '8': return big_digit_8;
-        case '9': return big_digit_9;
-        case '+': return big_char_plus;
-        case '-': return big_char_minus;
-        case '.': return big_char_dot;
-        case 'o': return big_char_degree;
-        case 'C': return big_char_C;
+        case '0': return big_digit_0_pag;
+        case '1': return big_digit_1_pag;
+        case '2': return big_digit_2_pag;
+        case '3': return big_digit_3_pag;
+        case '4': return big_digit_4_pag;
+        case '5': return big_digit_5_pag;
+        case '6': return big_digit_6_pag;
+        case '7': return big_digit_7_pag;
+        case '8': return big_digit_8_pag;
+        case '9': return big_digit_9_pag;
+        case '+': return big_char_plus_pag;
+        case '-': return big_char_minus_pag;
+        case '.': return big_char_dot_pag;
+        case 'o': return big_char_degree_pag;
+        case 'C': return big_char_C_pag;
         default: return NULL;
     }
 }
@@ -1,10 +1,14 @@
-#include <stdio.h>
 #include <stdint.h>
 #include "display_utils.h"
 #include "big_string_drawer.h"
+#include "formatacao.h"
 
-void mostrar_valor_grande(uint8_t *ssd, float valor, int y) {
-    char buffer[16];
-    snprintf(buffer, sizeof(buffer), "%+.1foC", valor);
+// Décimos com sinal fixo e "oC" (grau + C na fonte grande), sem printf
+void mostrar_valor_grande(uint8_t *ssd, int32_t mC, int y) {
+    char buffer[FORMATACAO_TAM_MAX + 2];
+    uint8_t n = formatar_mC(buffer, mC, 1, true);
+    buffer[n++] = 'o';
+    buffer[n++] = 'C';
+    buffer[n] = '\0';
     draw_big_string_aligned_right(ssd, y, buffer);
-}
\ No newline at end of file
+}
@@ -3,6 +3,7 @@
 
 #include <stdint.h>
 
-void mostrar_valor_grande(uint8_t *ssd, float valor, int y);
+// Temperatura (m°C) em fonte grande, alinhada à direita, com um decimal
+void mostrar_valor_grande(uint8_t *ssd, int32_t mC, int y);
 
 #endif
\ No newline at end of file
@@ -4,15 +4,11 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include "ssd1306.h"
+#include "font_big_paginas.h"
 
-// Desenha um caractere grande no buffer ssd[] a partir de bitmap de 64 bytes
-void draw_big_char(uint8_t *ssd, int x, int y, const uint8_t *bitmap) {
-    for (int row = 0; row < 32; row++) {
-        for (int col = 0; col < 16; col++) {
-            int byte_index = (row * 2) + (col / 8);
-            bool pixel = (bitmap[byte_index] >> (7 - (col % 8))) & 0x01;
-            ssd1306_set_pixel(ssd, x + col, y + row, pixel);
-        }
-    }
+// Desenha um caractere grande no buffer ssd[] a partir do glifo em páginas (64 bytes).
+// São 64 cópias de byte (128 com y fora do múltiplo de 8), sem set_pixel.
+static inline void draw_big_char(uint8_t *ssd, int x, int y, const uint8_t *glifo) {
+    ssd1306_blit_paginas(ssd, x, y, glifo, BIG_GLIFO_LARGURA, BIG_GLIFO_PAGINAS, true);
 }
 #endif
\ No newline at end of file
@@ -0,0 +1,121 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: font_big_paginas.c
+ *  Projeto: TempCycleDMA
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      GERADO por tools/gerar_fonte_paginas.py a partir de
+ *      font_big_logo_data.c — não editar à mão.
+ *
+ *      Glifos 16x32 em páginas do SSD1306: byte [p * 16 + c] é a
+ *      coluna c da página p (bit 0 = linha de cima).
+ * ------------------------------------------------------------
+ */
+
+#include "font_big_paginas.h"
+#include "caminho_rapido.h"
+
+const uint8_t big_digit_0_pag[BIG_GLIFO_BYTES] TABELA_RAPIDA = {
+  0xFC,0x02,0x01,0x01,0x01,0x01,0x02,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x03,0x04,0x08,0x08,0x08,0x08,0x04,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+};
+
+const uint8_t big_digit_1_pag[BIG_GLIFO_BYTES] TABELA_RAPIDA = {
+  0x00,0x04,0x02,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+};
+
+const uint8_t big_digit_2_pag[BIG_GLIFO_BYTES] TABELA_RAPIDA = {
+  0x00,0x02,0x01,0x81,0x41,0x21,0x12,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x0E,0x09,0x08,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+};
+
+const uint8_t big_digit_3_pag[BIG_GLIFO_BYTES] TABELA_RAPIDA = {
+  0x00,0x02,0x01,0x11,0x11,0x29,0x2A,0xC4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x02,0x04,0x04,0x04,0x04,0x02,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+};
+
+const uint8_t big_digit_4_pag[BIG_GLIFO_BYTES] TABELA_RAPIDA = {
+  0x60,0x50,0x48,0x44,0x42,0xFF,0x40,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+};
+
+const uint8_t big_digit_5_pag[BIG_GLIFO_BYTES] TABELA_RAPIDA = {
+  0x00,0x1F,0x11,0x11,0x11,0x11,0x21,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x02,0x04,0x04,0x04,0x04,0x02,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+};
+
+const uint8_t big_digit_6_pag[BIG_GLIFO_BYTES] TABELA_RAPIDA = {
+  0xFC,0x32,0x11,0x11,0x11,0x11,0x22,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x01,0x02,0x04,0x04,0x04,0x04,0x02,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+};
+
+const uint8_t big_digit_7_pag[BIG_GLIFO_BYTES] TABELA_RAPIDA = {
+  0x00,0x81,0x61,0x11,0x09,0x05,0x03,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+};
+
+const uint8_t big_digit_8_pag[BIG_GLIFO_BYTES] TABELA_RAPIDA = {
+  0x8C,0x52,0x21,0x21,0x21,0x21,0x52,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x01,0x02,0x04,0x04,0x04,0x04,0x02,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+};
+
+const uint8_t big_digit_9_pag[BIG_GLIFO_BYTES] TABELA_RAPIDA = {
+  0x1C,0x22,0x41,0x41,0x41,0x41,0x22,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x02,0x04,0x04,0x04,0x04,0x02,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+};
+
+const uint8_t big_char_plus_pag[BIG_GLIFO_BYTES] TABELA_RAPIDA = {
+  0x20,0x20,0x20,0x20,0xFC,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+};
+
+const uint8_t big_char_minus_pag[BIG_GLIFO_BYTES] TABELA_RAPIDA = {
+  0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+};
+
+const uint8_t big_char_dot_pag[BIG_GLIFO_BYTES] TABELA_RAPIDA = {
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0xE0,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+};
+
+const uint8_t big_char_degree_pag[BIG_GLIFO_BYTES] TABELA_RAPIDA = {
+  0x00,0x00,0x00,0x06,0x09,0x09,0x09,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+};
+
+const uint8_t big_char_C_pag[BIG_GLIFO_BYTES] TABELA_RAPIDA = {
+  0xFC,0x02,0x01,0x01,0x01,0x01,0x02,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x01,0x02,0x02,0x02,0x02,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+};
@@ -0,0 +1,40 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: font_big_paginas.h
+ *  Projeto: TempCycleDMA
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      GERADO por tools/gerar_fonte_paginas.py a partir de
+ *      font_big_logo_data.c — não editar à mão.
+ *
+ *      Glifos 16x32 em páginas do SSD1306: byte [p * 16 + c] é a
+ *      coluna c da página p (bit 0 = linha de cima).
+ * ------------------------------------------------------------
+ */
+
+#ifndef FONT_BIG_PAGINAS_H
+#define FONT_BIG_PAGINAS_H
+
+#include <stdint.h>
+
+#define BIG_GLIFO_LARGURA 16
+#define BIG_GLIFO_PAGINAS 4
+#define BIG_GLIFO_BYTES (BIG_GLIFO_LARGURA * BIG_GLIFO_PAGINAS)
+
+extern const uint8_t big_digit_0_pag[BIG_GLIFO_BYTES];
+extern const uint8_t big_digit_1_pag[BIG_GLIFO_BYTES];
+extern const uint8_t big_digit_2_pag[BIG_GLIFO_BYTES];
+extern const uint8_t big_digit_3_pag[BIG_GLIFO_BYTES];
+extern const uint8_t big_digit_4_pag[BIG_GLIFO_BYTES];
+extern const uint8_t big_digit_5_pag[BIG_GLIFO_BYTES];
+extern const uint8_t big_digit_6_pag[BIG_GLIFO_BYTES];
+extern const uint8_t big_digit_7_pag[BIG_GLIFO_BYTES];
+extern const uint8_t big_digit_8_pag[BIG_GLIFO_BYTES];
+extern const uint8_t big_digit_9_pag[BIG_GLIFO_BYTES];
+extern const uint8_t big_char_plus_pag[BIG_GLIFO_BYTES];
+extern const uint8_t big_char_minus_pag[BIG_GLIFO_BYTES];
+extern const uint8_t big_char_dot_pag[BIG_GLIFO_BYTES];
+extern const uint8_t big_char_degree_pag[BIG_GLIFO_BYTES];
+extern const uint8_t big_char_C_pag[BIG_GLIFO_BYTES];
+
+#endif
@@ -6,7 +6,17 @@ extern void ssd1306_send_buffer(uint8_t ssd[], int buffer_length);
 extern void ssd1306_init();
 extern void ssd1306_scroll(bool set);
 extern void render_on_display(uint8_t *ssd, struct render_area *area);
+extern bool ssd1306_flush_async(uint8_t *ssd, struct render_area *area, void (*concluido)(void));
+extern bool ssd1306_flush_alteracoes(uint8_t *ssd, void (*concluido)(void));
+extern bool ssd1306_flush_janela(uint8_t *ssd, const struct render_area *area, void (*concluido)(void));
+extern bool ssd1306_flush_ocupado(void);
+extern void ssd1306_flush_poll(void);
+extern void ssd1306_flush_aguardar(void);
+extern uint32_t ssd1306_flush_erros(void);
+extern void ssd1306_estatisticas(uint32_t *enviados, uint32_t *iguais);
 extern void ssd1306_set_pixel(uint8_t *ssd, int x, int y, bool set);
+extern void ssd1306_blit_paginas(uint8_t *ssd, int x, int y, const uint8_t *bloco,
+                                 int largura, int paginas, bool copiar);
 extern void ssd1306_draw_line(uint8_t *ssd, int x_0, int y_0, int x_1, int y_1, bool set);
 extern void ssd1306_draw_char(uint8_t *ssd, int16_t x, int16_t y, uint8_t character);
 //extern void ssd1306_draw_string(uint8_t *ssd, int16_t x, int16_t y, char *string);
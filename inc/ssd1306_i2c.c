@@ -5,37 +5,197 @@
 #include "pico/stdlib.h"
 #include "pico/binary_info.h"
 #include "hardware/i2c.h"
+#include "barramento_i2c.h"
 #include "ssd1306_font.h"
 #include "ssd1306_i2c.h"
+#include "caminho_rapido.h"
+
+// Palavras de 16 bits para o IC_DATA_CMD: o registrador precisa dos bits STOP/RESTART
+// por byte, por isso o DMA lê deste buffer estático em vez de ler o framebuffer direto.
+// Um envio vira uma cadeia de transações no barramento compartilhado: a janela de
+// endereçamento (0x00 + 6 comandos) e uma por página (0x40 + até 128 colunas). O
+// ponteiro de endereçamento do painel segue de uma transação para a outra, e uma
+// leitura de prioridade alta entra entre duas páginas em vez de esperar o quadro.
+#define SSD1306_MAX_FRAGMENTOS (1 + ssd1306_n_pages)
+static uint16_t ssd1306_tx_palavras[SSD1306_TX_PALAVRAS];
+static transacao_i2c_t ssd1306_fragmentos[SSD1306_MAX_FRAGMENTOS];
+static int ssd1306_n_palavras;
+static uint8_t ssd1306_n_fragmentos;
+static volatile uint8_t ssd1306_proximo_fragmento;
+static volatile bool ssd1306_cadeia_ativa = false;    // Ainda há fragmento no motor
+static volatile bool ssd1306_cadeia_falhou = false;
+
+// Maior lote de comandos enviado numa única transação bloqueante
+#define SSD1306_LOTE_MAX 32
+
+static bool ssd1306_flush_ativo = false;   // Envio cujo fim ainda não foi tratado
+static void (*ssd1306_flush_cb)(void) = NULL;
+static uint32_t ssd1306_flush_abortos = 0;
+
+// Cópia do que o painel está mostrando, para enviar só o que mudou.
+// Inválida após ssd1306_init(), um aborto no i2c ou um envio fora do rastreio.
+static uint8_t ssd1306_enviado[ssd1306_buffer_length];
+static bool ssd1306_enviado_valido = false;
+static uint32_t ssd1306_quadros_enviados, ssd1306_quadros_iguais;
+
+void ssd1306_flush_aguardar(void);
 
 // Calcular quanto do buffer será destinado à área de renderização
 void calculate_render_area_buffer_length(struct render_area *area) {
     area->buffer_length = (area->end_column - area->start_column + 1) * (area->end_page - area->start_page + 1);
 }
 
+// Envia uma lista de comandos numa só transação: controle 0x00 seguido do fluxo de comandos
+void ssd1306_send_command_list(uint8_t *ssd, int number) {
+    uint8_t buffer[1 + SSD1306_LOTE_MAX];
+    uint16_t palavras[1 + SSD1306_LOTE_MAX];
+
+    ssd1306_flush_aguardar();   // Não intercala com um quadro em andamento
+    while (number > 0) {
+        int n = number < SSD1306_LOTE_MAX ? number : SSD1306_LOTE_MAX;
+        buffer[0] = 0x00;
+        memcpy(buffer + 1, ssd, n);
+
+        transacao_i2c_t t = {
+            .endereco = ssd1306_i2c_address,
+            .prioridade = I2C_PRIORIDADE_BAIXA,
+            .palavras = palavras,
+            .n_palavras = barramento_i2c_montar(palavras, buffer, n + 1, 0),
+        };
+        barramento_i2c_executar(&t);
+        ssd += n;
+        number -= n;
+    }
+}
+
 // Processo de escrita do i2c espera um byte de controle, seguido por dados
 void ssd1306_send_command(uint8_t command) {
-    uint8_t buffer[2] = {0x80, command};
-    i2c_write_blocking(i2c1, ssd1306_i2c_address, buffer, 2, false);
+    ssd1306_send_command_list(&command, 1);
 }
 
-// Envia uma lista de comandos ao hardware
-void ssd1306_send_command_list(uint8_t *ssd, int number) {
-    for (int i = 0; i < number; i++) {
-        ssd1306_send_command(ssd[i]);
+// Passa para o próximo fragmento da cadeia (IRQ do i2c ou poll do barramento)
+static void CAMINHO_RAPIDO(ssd1306_fragmento_concluido)(transacao_i2c_t *t, bool ok) {
+    (void)t;
+    if (ok && ssd1306_proximo_fragmento < ssd1306_n_fragmentos) {
+        barramento_i2c_submeter(&ssd1306_fragmentos[ssd1306_proximo_fragmento++]);
+        return;
+    }
+    ssd1306_cadeia_falhou = !ok;   // Um NACK interrompe o resto do quadro
+    ssd1306_cadeia_ativa = false;
+}
+
+// Marca o STOP na última palavra e transforma as palavras desde 'inicio' num fragmento
+static void ssd1306_fechar_fragmento(int inicio) {
+    transacao_i2c_t *t = &ssd1306_fragmentos[ssd1306_n_fragmentos++];
+
+    ssd1306_tx_palavras[ssd1306_n_palavras - 1] |= I2C_IC_DATA_CMD_STOP_BITS;
+    memset(t, 0, sizeof(*t));
+    t->endereco = ssd1306_i2c_address;
+    t->prioridade = I2C_PRIORIDADE_BAIXA;
+    t->palavras = &ssd1306_tx_palavras[inicio];
+    t->n_palavras = (uint16_t)(ssd1306_n_palavras - inicio);
+    t->concluida = ssd1306_fragmento_concluido;
+}
+
+// Primeiro fragmento: janela de endereçamento da área
+static void ssd1306_empacotar_janela(const struct render_area *area) {
+    const uint8_t commands[] = {
+        ssd1306_set_column_address, area->start_column, area->end_column,
+        ssd1306_set_page_address, area->start_page, area->end_page
+    };
+
+    ssd1306_n_fragmentos = 0;
+    ssd1306_n_palavras = 0;
+    ssd1306_tx_palavras[ssd1306_n_palavras++] = 0x00;
+    for (unsigned i = 0; i < count_of(commands); i++) {
+        ssd1306_tx_palavras[ssd1306_n_palavras++] = commands[i];
+    }
+    ssd1306_fechar_fragmento(0);
+}
+
+// Fragmento de dados: controle 0x40 e 'n' bytes; com 'copia', guarda também o que foi enviado
+static void ssd1306_empacotar_dados(const uint8_t *dados, int n, uint8_t *copia) {
+    int inicio = ssd1306_n_palavras;
+
+    ssd1306_tx_palavras[ssd1306_n_palavras++] = 0x40;
+    for (int i = 0; i < n; i++) {
+        ssd1306_tx_palavras[ssd1306_n_palavras++] = dados[i];
+        if (copia) copia[i] = dados[i];
+    }
+    ssd1306_fechar_fragmento(inicio);
+}
+
+// Buffer contínuo em fragmentos de uma página; o painel avança o endereço sozinho
+static void ssd1306_empacotar_continuo(const uint8_t *ssd, int buffer_length) {
+    if (buffer_length > ssd1306_buffer_length) buffer_length = ssd1306_buffer_length;
+    for (int i = 0; i < buffer_length; i += ssd1306_width) {
+        int n = buffer_length - i < ssd1306_width ? buffer_length - i : ssd1306_width;
+        ssd1306_empacotar_dados(ssd + i, n, NULL);
+    }
+    ssd1306_enviado_valido = false;   // Envio sem passar pela cópia de rastreio
+}
+
+// Põe o primeiro fragmento no barramento; os demais seguem pelo callback
+static void ssd1306_disparar(void (*concluido)(void)) {
+    ssd1306_flush_cb = concluido;
+    ssd1306_flush_ativo = true;
+    ssd1306_cadeia_falhou = false;
+    ssd1306_cadeia_ativa = true;
+    ssd1306_proximo_fragmento = 1;
+    if (!barramento_i2c_submeter(&ssd1306_fragmentos[0])) {
+        ssd1306_cadeia_falhou = true;   // Barramento não iniciado
+        ssd1306_cadeia_ativa = false;
     }
 }
 
-// Copia buffer de referência num novo buffer, a fim de adicionar o byte de controle desde o início
+// Envia o buffer com o byte de controle à frente, sem heap (espera o fim)
 void ssd1306_send_buffer(uint8_t ssd[], int buffer_length) {
-    uint8_t *temp_buffer = malloc(buffer_length + 1);
+    ssd1306_flush_aguardar();
+    ssd1306_n_fragmentos = 0;
+    ssd1306_n_palavras = 0;
+    ssd1306_empacotar_continuo(ssd, buffer_length);
+    ssd1306_disparar(NULL);
+    ssd1306_flush_aguardar();
+}
+
+// Indica se ainda há fragmentos no barramento, e trata o fim de um envio
+bool ssd1306_flush_ocupado(void) {
+    if (!ssd1306_flush_ativo) return false;
+
+    barramento_i2c_poll();
+    if (ssd1306_cadeia_ativa) return true;
+
+    if (ssd1306_cadeia_falhou) {
+        ssd1306_flush_abortos++;
+        ssd1306_enviado_valido = false;   // Painel pode ter ficado pela metade
+    }
+    ssd1306_flush_ativo = false;
+    void (*cb)(void) = ssd1306_flush_cb;
+    ssd1306_flush_cb = NULL;
+    if (cb) cb();
+    return false;
+}
+
+// Chamado periodicamente (ex.: tempo ocioso) para disparar o callback de conclusão
+void ssd1306_flush_poll(void) {
+    (void)ssd1306_flush_ocupado();
+}
 
-    temp_buffer[0] = 0x40;
-    memcpy(temp_buffer + 1, ssd, buffer_length);
+// Espera ativa até o fim da transferência corrente (se houver)
+void ssd1306_flush_aguardar(void) {
+    while (ssd1306_flush_ocupado()) {
+        tight_loop_contents();
+    }
+}
 
-    i2c_write_blocking(i2c1, ssd1306_i2c_address, temp_buffer, buffer_length + 1, false);
+uint32_t ssd1306_flush_erros(void) {
+    return ssd1306_flush_abortos;
+}
 
-    free(temp_buffer);
+// Quadros que foram ao barramento e quadros descartados por não terem mudado
+void ssd1306_estatisticas(uint32_t *enviados, uint32_t *iguais) {
+    *enviados = ssd1306_quadros_enviados;
+    *iguais = ssd1306_quadros_iguais;
 }
 
 // Cria a lista de comandos (com base nos endereços definidos em ssd1306_i2c.h) para a inicialização do display
@@ -61,7 +221,24 @@ void ssd1306_init() {
         ssd1306_set_display | 0x01,
     };
 
-    ssd1306_send_command_list(commands, count_of(commands));
+    // Sem esperar o barramento: o primeiro quadro entra na mesma fila, depois dos comandos
+    static uint8_t buffer[1 + SSD1306_LOTE_MAX];
+    static uint16_t palavras[1 + SSD1306_LOTE_MAX];
+    static transacao_i2c_t t;
+    _Static_assert(sizeof(commands) <= SSD1306_LOTE_MAX, "init do ssd1306 precisa caber num lote");
+
+    barramento_i2c_iniciar(i2c1);   // Sem efeito se o setup já iniciou o barramento
+    ssd1306_flush_aguardar();
+    while (t.pendente) barramento_i2c_poll();
+
+    buffer[0] = 0x00;
+    memcpy(buffer + 1, commands, sizeof(commands));
+    t.endereco = ssd1306_i2c_address;
+    t.prioridade = I2C_PRIORIDADE_BAIXA;
+    t.palavras = palavras;
+    t.n_palavras = barramento_i2c_montar(palavras, buffer, 1 + sizeof(commands), 0);
+    barramento_i2c_submeter(&t);
+    ssd1306_enviado_valido = false;   // RAM do painel é indefinida após o reset
 }
 
 // Cria a lista de comandos para configurar o scrolling
@@ -74,19 +251,117 @@ void ssd1306_scroll(bool set) {
     ssd1306_send_command_list(commands, count_of(commands));
 }
 
-// Atualiza uma parte do display com uma área de renderização
-void render_on_display(uint8_t *ssd, struct render_area *area) {
-    uint8_t commands[] = {
-        ssd1306_set_column_address, area->start_column, area->end_column,
-        ssd1306_set_page_address, area->start_page, area->end_page
-    };
+// Inicia a atualização de uma área sem esperar: janela de endereçamento e dados vão para a
+// fila do barramento. O framebuffer pode ser alterado logo após o retorno.
+bool ssd1306_flush_async(uint8_t *ssd, struct render_area *area, void (*concluido)(void)) {
+    if (ssd1306_flush_ocupado()) return false;
 
-    ssd1306_send_command_list(commands, count_of(commands));
-    ssd1306_send_buffer(ssd, area->buffer_length);
+    ssd1306_empacotar_janela(area);
+    ssd1306_empacotar_continuo(ssd, area->buffer_length);
+    ssd1306_disparar(concluido);
+    return true;
+}
+
+// Calcula a menor janela (páginas × colunas) que cobre tudo o que difere do painel
+static bool CAMINHO_RAPIDO(ssd1306_janela_alterada)(const uint8_t *ssd, struct render_area *janela) {
+    if (!ssd1306_enviado_valido) {
+        janela->start_column = 0;
+        janela->end_column = ssd1306_width - 1;
+        janela->start_page = 0;
+        janela->end_page = ssd1306_n_pages - 1;
+        calculate_render_area_buffer_length(janela);
+        return true;
+    }
+
+    int col_ini = ssd1306_width, col_fim = -1;
+    int pag_ini = -1, pag_fim = -1;
+
+    for (int p = 0; p < ssd1306_n_pages; p++) {
+        const uint8_t *novo = ssd + p * ssd1306_width;
+        const uint8_t *antigo = ssd1306_enviado + p * ssd1306_width;
+        if (memcmp(novo, antigo, ssd1306_width) == 0) continue;
+
+        int a = 0, b = ssd1306_width - 1;
+        while (novo[a] == antigo[a]) a++;
+        while (novo[b] == antigo[b]) b--;
+
+        if (pag_ini < 0) pag_ini = p;
+        pag_fim = p;
+        if (a < col_ini) col_ini = a;
+        if (b > col_fim) col_fim = b;
+    }
+
+    if (pag_ini < 0) return false;
+
+    janela->start_column = col_ini;
+    janela->end_column = col_fim;
+    janela->start_page = pag_ini;
+    janela->end_page = pag_fim;
+    calculate_render_area_buffer_length(janela);
+    return true;
+}
+
+// Monta a janela página a página (atualizando a cópia do painel) e dispara
+static void ssd1306_enviar_rastreado(const uint8_t *ssd, const struct render_area *janela,
+                                     void (*concluido)(void)) {
+    ssd1306_quadros_enviados++;
+
+    int largura = janela->end_column - janela->start_column + 1;
+    ssd1306_empacotar_janela(janela);
+    for (int p = janela->start_page; p <= janela->end_page; p++) {
+        int i = p * ssd1306_width + janela->start_column;
+        ssd1306_empacotar_dados(ssd + i, largura, ssd1306_enviado + i);
+    }
+    ssd1306_disparar(concluido);
+}
+
+/**
+ * @brief Envia pelo barramento apenas a janela do framebuffer que mudou desde o último envio.
+ *
+ * O framebuffer 'ssd' é o quadro completo (128 × 8 páginas). Sem alterações,
+ * nada vai ao barramento e o callback é chamado na hora.
+ *
+ * @return false se a transferência anterior ainda está em andamento.
+ */
+bool ssd1306_flush_alteracoes(uint8_t *ssd, void (*concluido)(void)) {
+    if (ssd1306_flush_ocupado()) return false;
+
+    struct render_area janela;
+    if (!ssd1306_janela_alterada(ssd, &janela)) {
+        ssd1306_quadros_iguais++;
+        if (concluido) concluido();
+        return true;
+    }
+    ssd1306_enviar_rastreado(ssd, &janela, concluido);
+    ssd1306_enviado_valido = true;
+    return true;
+}
+
+/**
+ * @brief Envia pelo barramento uma janela escolhida do framebuffer completo.
+ *
+ * Diferente de ssd1306_flush_async(), os dados saem do quadro de 128 × 8
+ * páginas e a cópia do painel é atualizada, então o próximo
+ * ssd1306_flush_alteracoes() não reenvia a janela.
+ *
+ * @return false se a transferência anterior ainda está em andamento.
+ */
+bool ssd1306_flush_janela(uint8_t *ssd, const struct render_area *area, void (*concluido)(void)) {
+    if (ssd1306_flush_ocupado()) return false;
+
+    ssd1306_enviar_rastreado(ssd, area, concluido);
+    return true;
+}
+
+// Atualiza uma parte do display com uma área de renderização (bloqueante)
+void render_on_display(uint8_t *ssd, struct render_area *area) {
+    ssd1306_flush_aguardar();
+    ssd1306_flush_async(ssd, area, NULL);
+    ssd1306_flush_aguardar();
 }
 
 // Determina o pixel a ser aceso (no display) de acordo com a coordenada fornecida
-void ssd1306_set_pixel(uint8_t *ssd, int x, int y, bool set) {
+void CAMINHO_RAPIDO(ssd1306_set_pixel)(uint8_t *ssd, int x, int y, bool set) {
     assert(x >= 0 && x < ssd1306_width && y >= 0 && y < ssd1306_height);
 
     const int bytes_per_row = ssd1306_width;
@@ -133,7 +408,7 @@ void ssd1306_draw_line(uint8_t *ssd, int x_0, int y_0, int x_1, int y_1, bool se
 }
 
 // Adquire os pixels para um caractere (de acordo com ssd1306_font.h)
-inline int ssd1306_get_font(uint8_t character)
+static inline int ssd1306_get_font(uint8_t character)
 {
   if (character >= 'A' && character <= 'Z') {
     return character - 'A' + 1;
@@ -181,33 +456,42 @@ void ssd1306_command(ssd1306_t *ssd, uint8_t command) {
 	ssd->i2c_port, ssd->address, ssd->port_buffer, 2, false );
 }
 
+// Lote de comandos numa só transação (controle 0x00), para o caso do bitmap
+static void ssd1306_command_list_bm(ssd1306_t *ssd, const uint8_t *commands, int number) {
+    uint8_t buffer[1 + SSD1306_LOTE_MAX];
+
+    while (number > 0) {
+        int n = number < SSD1306_LOTE_MAX ? number : SSD1306_LOTE_MAX;
+        buffer[0] = 0x00;
+        memcpy(buffer + 1, commands, n);
+        i2c_write_blocking(ssd->i2c_port, ssd->address, buffer, n + 1, false);
+        commands += n;
+        number -= n;
+    }
+}
+
 // Função de configuração do display para o caso do bitmap
 void ssd1306_config(ssd1306_t *ssd) {
-    ssd1306_command(ssd, ssd1306_set_display | 0x00);
-    ssd1306_command(ssd, ssd1306_set_memory_mode);
-    ssd1306_command(ssd, 0x01);
-    ssd1306_command(ssd, ssd1306_set_display_start_line | 0x00);
-    ssd1306_command(ssd, ssd1306_set_segment_remap | 0x01);
-    ssd1306_command(ssd, ssd1306_set_mux_ratio);
-    ssd1306_command(ssd, ssd1306_height - 1);
-    ssd1306_command(ssd, ssd1306_set_common_output_direction | 0x08);
-    ssd1306_command(ssd, ssd1306_set_display_offset);
-    ssd1306_command(ssd, 0x00);
-    ssd1306_command(ssd, ssd1306_set_common_pin_configuration);
-    ssd1306_command(ssd, 0x12);
-    ssd1306_command(ssd, ssd1306_set_display_clock_divide_ratio);
-    ssd1306_command(ssd, 0x80);
-    ssd1306_command(ssd, ssd1306_set_precharge);
-    ssd1306_command(ssd, 0xF1);
-    ssd1306_command(ssd, ssd1306_set_vcomh_deselect_level);
-    ssd1306_command(ssd, 0x30);
-    ssd1306_command(ssd, ssd1306_set_contrast);
-    ssd1306_command(ssd, 0xFF);
-    ssd1306_command(ssd, ssd1306_set_entire_on);
-    ssd1306_command(ssd, ssd1306_set_normal_display);
-    ssd1306_command(ssd, ssd1306_set_charge_pump);
-    ssd1306_command(ssd, 0x14);
-    ssd1306_command(ssd, ssd1306_set_display | 0x01);
+    const uint8_t commands[] = {
+        ssd1306_set_display | 0x00,
+        ssd1306_set_memory_mode, 0x01,
+        ssd1306_set_display_start_line | 0x00,
+        ssd1306_set_segment_remap | 0x01,
+        ssd1306_set_mux_ratio, ssd1306_height - 1,
+        ssd1306_set_common_output_direction | 0x08,
+        ssd1306_set_display_offset, 0x00,
+        ssd1306_set_common_pin_configuration, 0x12,
+        ssd1306_set_display_clock_divide_ratio, 0x80,
+        ssd1306_set_precharge, 0xF1,
+        ssd1306_set_vcomh_deselect_level, 0x30,
+        ssd1306_set_contrast, 0xFF,
+        ssd1306_set_entire_on,
+        ssd1306_set_normal_display,
+        ssd1306_set_charge_pump, 0x14,
+        ssd1306_set_display | 0x01,
+    };
+
+    ssd1306_command_list_bm(ssd, commands, count_of(commands));
 }
 
 // Inicializa o display para o caso de exibição de bitmap
@@ -225,16 +509,63 @@ void ssd1306_init_bm(ssd1306_t *ssd, uint8_t width, uint8_t height, bool externa
 
 // Envia os dados ao display
 void ssd1306_send_data(ssd1306_t *ssd) {
-    ssd1306_command(ssd, ssd1306_set_column_address);
-    ssd1306_command(ssd, 0);
-    ssd1306_command(ssd, ssd->width - 1);
-    ssd1306_command(ssd, ssd1306_set_page_address);
-    ssd1306_command(ssd, 0);
-    ssd1306_command(ssd, ssd->pages - 1);
+    const uint8_t commands[] = {
+        ssd1306_set_column_address, 0, ssd->width - 1,
+        ssd1306_set_page_address, 0, ssd->pages - 1
+    };
+
+    ssd1306_command_list_bm(ssd, commands, count_of(commands));
     i2c_write_blocking(
     ssd->i2c_port, ssd->address, ssd->ram_buffer, ssd->bufsize, false );
 }
 
+/**
+ * @brief Copia um bloco já em formato de páginas (coluna de 8 px por byte) para o framebuffer.
+ *
+ * 'bloco' tem 'paginas' linhas de 'largura' bytes. Com y múltiplo de 8 cada
+ * byte vai direto para a página; caso contrário ele é deslocado e dividido
+ * entre duas páginas. Colunas e páginas fora da tela são recortadas.
+ *
+ * @param copiar true substitui os pixels da área (fundo apagado); false faz OR.
+ */
+void CAMINHO_RAPIDO(ssd1306_blit_paginas)(uint8_t *ssd, int x, int y, const uint8_t *bloco,
+                          int largura, int paginas, bool copiar) {
+    int pag0 = (y >= 0) ? (y >> 3) : -((7 - y) >> 3);
+    int desloc = y - pag0 * 8;
+
+    for (int c = 0; c < largura; c++) {
+        int xc = x + c;
+        if (xc < 0 || xc >= ssd1306_width) continue;
+        uint8_t *coluna = ssd + xc;
+
+        for (int p = 0; p < paginas; p++) {
+            uint8_t b = bloco[p * largura + c];
+            int destino = pag0 + p;
+
+            if (desloc == 0) {
+                if (destino < 0 || destino >= ssd1306_n_pages) continue;
+                uint8_t *d = coluna + destino * ssd1306_width;
+                *d = copiar ? b : (uint8_t)(*d | b);
+                continue;
+            }
+
+            // Parte de cima do byte vai para a página 'destino', o resto para a seguinte
+            if (destino >= 0 && destino < ssd1306_n_pages) {
+                uint8_t *d = coluna + destino * ssd1306_width;
+                uint8_t masc = (uint8_t)(0xFF << desloc);
+                uint8_t v = (uint8_t)(b << desloc);
+                *d = copiar ? (uint8_t)((*d & ~masc) | v) : (uint8_t)(*d | v);
+            }
+            if (destino + 1 >= 0 && destino + 1 < ssd1306_n_pages) {
+                uint8_t *d = coluna + (destino + 1) * ssd1306_width;
+                uint8_t masc = (uint8_t)(0xFF >> (8 - desloc));
+                uint8_t v = (uint8_t)(b >> (8 - desloc));
+                *d = copiar ? (uint8_t)((*d & ~masc) | v) : (uint8_t)(*d | v);
+            }
+        }
+    }
+}
+
 // Desenha o bitmap (a ser fornecido em display_oled.c) no display
 void ssd1306_draw_bitmap(ssd1306_t *ssd, const uint8_t *bitmap) {
     for (int i = 0; i < ssd->bufsize - 1; i++) {
@@ -244,14 +575,7 @@ void ssd1306_draw_bitmap(ssd1306_t *ssd, const uint8_t *bitmap) {
     }
 }
 
+// Limpa apenas o framebuffer; o painel é atualizado no próximo ssd1306_flush_alteracoes()
 void ssd1306_clear_display(uint8_t *ssd) {
     memset(ssd, 0, ssd1306_buffer_length);
-    struct render_area area = {
-        .start_column = 0,
-        .end_column = ssd1306_width - 1,
-        .start_page = 0,
-        .end_page = ssd1306_n_pages - 1
-    };
-    calculate_render_area_buffer_length(&area);
-    render_on_display(ssd, &area);
 }
@@ -44,6 +44,11 @@
 #define ssd1306_n_pages (ssd1306_height / ssd1306_page_height)
 #define ssd1306_buffer_length (ssd1306_n_pages * ssd1306_width)
 
+// Palavras da cadeia de envio por DMA: janela de endereçamento (0x00 + 6
+// comandos) e, por página, o controle 0x40 e as colunas (ssd1306_i2c.c)
+#define SSD1306_PALAVRAS_JANELA 6
+#define SSD1306_TX_PALAVRAS (1 + SSD1306_PALAVRAS_JANELA + ssd1306_n_pages * (1 + ssd1306_width))
+
 #define ssd1306_write_mode _u(0xFE)
 #define ssd1306_read_mode _u(0xFF)
 
@@ -0,0 +1,161 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: instrumentacao.c
+ *  Projeto: TempCycleDMA
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Coleta de estatísticas de tempo por ponto de medição.
+ *
+ *      O registro é O(1): atualiza mín/máx/soma e incrementa
+ *      um balde do histograma escolhido pela posição do bit
+ *      mais significativo. Os contadores de balde saturam em
+ *      vez de dar a volta.
+ *
+ *      A IRQ do DMA pode registrar em outro núcleo (dual-core);
+ *      uma leitura durante o registro pode ver um ponto
+ *      parcialmente atualizado, o que é aceitável para um
+ *      relatório de diagnóstico.
+ *
+ *      O relatório inclui os contadores de acesso e acerto do
+ *      cache do XIP (globais: os dois núcleos e o DMA), zerados
+ *      junto com as estatísticas, para comparar o jitter com e
+ *      sem o perfil TEMPCYCLE_FAST_PATH. Os contadores são de
+ *      32 bits e dão a volta em alguns minutos com o XIP
+ *      ocupado: convém zerar pouco antes de medir.
+ *
+ *  Relacionamento:
+ *      - 'executor.c' registra cada execução de tarefa.
+ *      - 'irq_handlers.c' registra a IRQ do DMA.
+ *
+ *  
+ *  Data: 14/10/2026
+ * ------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "hardware/structs/xip_ctrl.h"
+#include "instrumentacao.h"
+#include "caminho_rapido.h"
+
+static instr_ponto_t pontos[INSTR_NUM_PONTOS];
+
+// Estado da medição da IRQ do DMA
+static uint32_t irq_entrada_us = 0;
+static uint32_t irq_anterior_us = 0;
+
+static uint64_t xip_zerado_us = 0;   // Início da contagem do cache do XIP
+
+/**
+ * @brief Balde log2: 0 → [0,1) µs, k → [2^(k-1), 2^k) µs.
+ */
+static uint8_t CAMINHO_RAPIDO(balde)(uint32_t us) {
+    uint8_t b = us ? (uint8_t)(32 - __builtin_clz(us)) : 0;
+    return b < INSTR_BALDES ? b : INSTR_BALDES - 1;
+}
+
+static void zerar_ponto(instr_ponto_t *p) {
+    const char *nome = p->nome;
+    memset(p, 0, sizeof(*p));
+    p->nome = nome;
+    p->dur_min_us = UINT32_MAX;
+    p->atraso_min_us = UINT32_MAX;
+}
+
+void instr_nomear(uint8_t ponto, const char *nome) {
+    if (ponto < INSTR_NUM_PONTOS) {
+        pontos[ponto].nome = nome;
+    }
+}
+
+void instr_zerar(void) {
+    for (int i = 0; i < INSTR_NUM_PONTOS; i++) {
+        zerar_ponto(&pontos[i]);
+    }
+    // Qualquer escrita zera o contador
+    xip_ctrl_hw->ctr_acc = 0;
+    xip_ctrl_hw->ctr_hit = 0;
+    xip_zerado_us = time_us_64();
+}
+
+void CAMINHO_RAPIDO(instr_registrar)(uint8_t ponto, uint32_t atraso_us, uint32_t duracao_us) {
+    if (ponto >= INSTR_NUM_PONTOS) return;
+    instr_ponto_t *p = &pontos[ponto];
+
+    if (p->n == 0) {
+        p->dur_min_us = UINT32_MAX;
+        p->atraso_min_us = UINT32_MAX;
+    }
+    p->n++;
+    p->dur_soma_us += duracao_us;
+    if (duracao_us < p->dur_min_us) p->dur_min_us = duracao_us;
+    if (duracao_us > p->dur_max_us) p->dur_max_us = duracao_us;
+    if (atraso_us < p->atraso_min_us) p->atraso_min_us = atraso_us;
+    if (atraso_us > p->atraso_max_us) p->atraso_max_us = atraso_us;
+
+    uint16_t *h = &p->hist_dur[balde(duracao_us)];
+    if (*h != UINT16_MAX) (*h)++;
+    h = &p->hist_atraso[balde(atraso_us)];
+    if (*h != UINT16_MAX) (*h)++;
+}
+
+void CAMINHO_RAPIDO(instr_irq_dma_entrada)(void) {
+    irq_entrada_us = time_us_32();
+}
+
+void CAMINHO_RAPIDO(instr_irq_dma_saida)(uint32_t periodo_nominal_us) {
+    uint32_t agora = time_us_32();
+    uint32_t desvio = 0;
+
+    if (irq_anterior_us != 0) {
+        uint32_t intervalo = irq_entrada_us - irq_anterior_us;
+        desvio = intervalo > periodo_nominal_us ? intervalo - periodo_nominal_us
+                                                : periodo_nominal_us - intervalo;
+    }
+    irq_anterior_us = irq_entrada_us;
+    instr_registrar(INSTR_IRQ_DMA, desvio, agora - irq_entrada_us);
+}
+
+void instr_irq_dma_retomar(void) {
+    irq_anterior_us = 0;
+}
+
+const instr_ponto_t *instr_ponto(uint8_t ponto) {
+    return ponto < INSTR_NUM_PONTOS ? &pontos[ponto] : NULL;
+}
+
+static void imprimir_histograma(const char *rotulo, const uint16_t *h) {
+    printf("    %s:", rotulo);
+    for (int b = 0; b < INSTR_BALDES; b++) {
+        if (h[b]) printf(" <%luus:%u", (unsigned long)(1ul << b), h[b]);
+    }
+    printf("\n");
+}
+
+void instr_relatorio(void) {
+    printf("Instrumentacao (min/med/max em us):\n");
+    for (int i = 0; i < INSTR_NUM_PONTOS; i++) {
+        const instr_ponto_t *p = &pontos[i];
+        if (p->n == 0) continue;
+
+        printf("  %-10s n=%lu dur %lu/%lu/%lu atraso %lu..%lu (jitter %lu)\n",
+               p->nome ? p->nome : "?", (unsigned long)p->n,
+               (unsigned long)p->dur_min_us, (unsigned long)(p->dur_soma_us / p->n),
+               (unsigned long)p->dur_max_us,
+               (unsigned long)p->atraso_min_us, (unsigned long)p->atraso_max_us,
+               (unsigned long)(p->atraso_max_us - p->atraso_min_us));
+        imprimir_histograma("dur   ", p->hist_dur);
+        imprimir_histograma("atraso", p->hist_atraso);
+    }
+
+    uint32_t acessos = xip_ctrl_hw->ctr_acc;
+    uint32_t acertos = xip_ctrl_hw->ctr_hit;
+    uint32_t faltas = acessos - acertos;
+    printf("  XIP %s: %lu acessos, %lu faltas (acerto %lu.%lu%%) em %lu ms\n",
+           TEMPCYCLE_FAST_PATH ? "(caminho rapido na SRAM)" : "(tudo na flash)",
+           (unsigned long)acessos, (unsigned long)faltas,
+           (unsigned long)(acessos ? (uint64_t)acertos * 100u / acessos : 0),
+           (unsigned long)(acessos ? (uint64_t)acertos * 1000u / acessos % 10u : 0),
+           (unsigned long)((time_us_64() - xip_zerado_us) / 1000u));
+}
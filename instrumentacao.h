@@ -0,0 +1,88 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: instrumentacao.h
+ *  Projeto: TempCycleDMA
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Instrumentação de tempo de execução das tarefas do
+ *      executor e da IRQ do DMA.
+ *
+ *      Para cada ponto medido são mantidos mínimo, máximo e
+ *      média da duração, além de histogramas em escala log2
+ *      (1 µs, 2 µs, 4 µs, ...) da duração e do atraso de
+ *      início em relação à liberação nominal. Com isso se
+ *      obtém WCET e jitter para dimensionar o escalonamento.
+ *
+ *      Os dados só são impressos quando pedidos pelo USB.
+ *
+ *  
+ *  Data: 14/10/2026
+ * ------------------------------------------------------------
+ */
+
+#ifndef INSTRUMENTACAO_H
+#define INSTRUMENTACAO_H
+
+#include <stdint.h>
+#include "executor.h"
+
+#define INSTR_BALDES 20   // Último balde: ≥ 2^18 µs (~262 ms)
+
+// Pontos medidos: um por tarefa do executor e um para a IRQ do DMA
+enum {
+    INSTR_IRQ_DMA = EXECUTOR_MAX_TAREFAS,
+    INSTR_NUM_PONTOS
+};
+
+typedef struct {
+    const char *nome;
+    uint32_t n;
+    uint32_t dur_min_us, dur_max_us;
+    uint64_t dur_soma_us;
+    uint32_t atraso_min_us, atraso_max_us;
+    uint16_t hist_dur[INSTR_BALDES];
+    uint16_t hist_atraso[INSTR_BALDES];
+} instr_ponto_t;
+
+/**
+ * @brief Dá nome a um ponto de medição (exibido no relatório).
+ */
+void instr_nomear(uint8_t ponto, const char *nome);
+
+/**
+ * @brief Registra uma execução.
+ *
+ * @param ponto Índice do ponto (tarefa do executor ou INSTR_IRQ_DMA)
+ * @param atraso_us Início real menos a liberação nominal
+ * @param duracao_us Tempo de execução
+ */
+void instr_registrar(uint8_t ponto, uint32_t atraso_us, uint32_t duracao_us);
+
+/**
+ * @brief Mede a IRQ do DMA: chamada na entrada e na saída do tratamento
+ *        de cada bloco, com o período nominal entre blocos.
+ *
+ * O atraso registrado é o desvio do intervalo entre IRQs em relação ao
+ * período nominal (latência/jitter de atendimento).
+ */
+void instr_irq_dma_entrada(void);
+void instr_irq_dma_saida(uint32_t periodo_nominal_us);
+// ADC religado após uma pausa: a próxima IRQ não entra no jitter
+void instr_irq_dma_retomar(void);
+
+/**
+ * @brief Acesso somente leitura a um ponto (NULL se inválido).
+ */
+const instr_ponto_t *instr_ponto(uint8_t ponto);
+
+/**
+ * @brief Zera todas as estatísticas.
+ */
+void instr_zerar(void);
+
+/**
+ * @brief Imprime estatísticas e histogramas de todos os pontos com dados.
+ */
+void instr_relatorio(void);
+
+#endif  // INSTRUMENTACAO_H
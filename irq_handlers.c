@@ -4,20 +4,27 @@
  *  Projeto: TempCycleDMA
  * ------------------------------------------------------------
  *  Descrição:
- *      Este arquivo implementa o handler de interrupção do
- *      canal DMA 0, utilizado para leitura do sensor interno
- *      de temperatura via ADC do Raspberry Pi Pico W.
+ *      Este arquivo implementa o handler de interrupção dos
+ *      canais DMA 0 e 1, utilizados em ping-pong para leitura
+ *      do sensor interno de temperatura via ADC do Raspberry
+ *      Pi Pico W.
  *
  *      A função 'dma_handler_temp()' é responsável por
- *      capturar a interrupção do DMA, limpar o status e
- *      sinalizar a finalização da transferência de dados
- *      via flag global 'dma_temp_done'.
+ *      capturar a interrupção do DMA, limpar o status de cada
+ *      canal concluído e repassar a metade correspondente do
+ *      buffer para redução em 'tarefa1_temp.c'.
+ *
+ *      No modo sequenciado o canal 1 é o canal de controle da
+ *      cadeia de janelas e roda sem IRQ (IRQ_QUIET): chega uma
+ *      única interrupção do canal 0 por janela de N amostras.
  *
  *  Relacionamento:
  *      - Este handler é registrado em 'setup.c' usando:
  *            irq_set_exclusive_handler(DMA_IRQ_0, dma_handler_temp);
- *      - A flag 'dma_temp_done' é usada em 'tarefa1_temp.c'
- *        para controlar o fluxo da aquisição via DMA.
+ *      - 'tarefa1_bloco_concluido()' (tarefa1_temp.c) reduz a
+ *        metade recém-preenchida.
+ *      - A latência e a duração do handler são registradas em
+ *        'instrumentacao.c', e a pilha na entrada em 'memoria.c'.
  *
  *  
  *  Data: 11/05/2025
@@ -26,20 +33,34 @@
 
 #include "hardware/dma.h"
 #include "irq_handlers.h"
-
-// Flag global que sinaliza a conclusão da transferência DMA
-volatile bool dma_temp_done = false;
+#include "setup.h"
+#include "tarefa1_temp.h"
+#include "instrumentacao.h"
+#include "caminho_rapido.h"
+#include "memoria.h"
 
 /**
- * @brief Handler de interrupção do canal DMA 0.
+ * @brief Handler de interrupção dos canais DMA 0 e 1.
  *
- * Esta função é chamada automaticamente quando o canal 0 do DMA
- * completa a transferência das amostras do ADC para o buffer.
- * Ela limpa a flag da interrupção e ativa o sinalizador
- * 'dma_temp_done' para que o laço principal saiba que pode
- * prosseguir.
+ * Esta função é chamada automaticamente quando um dos canais do
+ * ping-pong completa a sua metade do buffer. O outro canal já foi
+ * disparado pelo encadeamento, então aqui basta limpar a flag da
+ * interrupção e entregar a metade concluída à Tarefa 1.
  */
-void dma_handler_temp() {
-    dma_hw->ints0 = 1u << 0;   // Limpa a interrupção do canal 0
-    dma_temp_done = true;     // Sinaliza conclusão para o executor
+void CAMINHO_RAPIDO(dma_handler_temp)() {
+    instr_irq_dma_entrada();
+    memoria_irq_entrada(MEMORIA_IRQ_DMA);
+
+    uint32_t pendentes = dma_hw->ints0 &
+        ((1u << DMA_TEMP_CHANNEL) | (1u << DMA_TEMP_CHANNEL_B));
+    dma_hw->ints0 = pendentes;   // Limpa a interrupção dos canais atendidos
+
+    if (pendentes & (1u << DMA_TEMP_CHANNEL)) {
+        tarefa1_bloco_concluido(0);
+    }
+    if (pendentes & (1u << DMA_TEMP_CHANNEL_B)) {
+        tarefa1_bloco_concluido(1);
+    }
+
+    instr_irq_dma_saida(tarefa1_periodo_bloco_us());
 }
\ No newline at end of file
@@ -3,7 +3,6 @@
 
 #include <stdbool.h>
 
-extern volatile bool dma_temp_done;
 void dma_handler_temp(void);
 
-#endif
\ No newline at end of file
+#endif
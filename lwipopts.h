@@ -0,0 +1,57 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: lwipopts.h
+ *  Projeto: TempCycleDMA
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Configuração do lwIP para o build com TEMPCYCLE_WIFI
+ *      (pico_cyw43_arch_lwip_threadsafe_background).
+ *
+ *      Só o necessário para a telemetria: IPv4, DHCP, ARP e
+ *      UDP, sem TCP nem sockets. O heap (MEM_SIZE) comporta os
+ *      REDE_PBUFS lotes de 'telemetria_rede.c' mais o tráfego
+ *      do DHCP.
+ *
+ *
+ *  Data: 14/10/2026
+ * ------------------------------------------------------------
+ */
+
+#ifndef LWIPOPTS_H
+#define LWIPOPTS_H
+
+// Sem sistema operacional: o cyw43_arch roda o lwIP numa IRQ de baixa prioridade
+#define NO_SYS                      1
+#define LWIP_SOCKET                 0
+#define LWIP_NETCONN                0
+#define SYS_LIGHTWEIGHT_PROT        1
+
+#define MEM_LIBC_MALLOC             0
+#define MEM_ALIGNMENT               4
+#define MEM_SIZE                    4000
+#define MEMP_NUM_UDP_PCB            4
+#define MEMP_NUM_SYS_TIMEOUT        8
+#define PBUF_POOL_SIZE              8
+
+#define LWIP_IPV4                   1
+#define LWIP_IPV6                   0
+#define LWIP_ARP                    1
+#define LWIP_ETHERNET               1
+#define LWIP_ICMP                   1
+#define LWIP_RAW                    0
+#define LWIP_UDP                    1
+#define LWIP_TCP                    0
+#define LWIP_DHCP                   1
+#define LWIP_DNS                    0
+#define DHCP_DOES_ARP_CHECK         0
+#define LWIP_DHCP_DOES_ACD_CHECK    0
+
+#define LWIP_NETIF_STATUS_CALLBACK  1
+#define LWIP_NETIF_LINK_CALLBACK    1
+#define LWIP_NETIF_HOSTNAME         1
+#define LWIP_NETIF_TX_SINGLE_PBUF   1
+#define LWIP_CHKSUM_ALGORITHM       3
+
+#define LWIP_STATS                  0
+
+#endif  // LWIPOPTS_H
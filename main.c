@@ -5,14 +5,25 @@
  * ------------------------------------------------------------
  *  Descrição:
  *      Ciclo principal do sistema embarcado, baseado em um
- *      executor cíclico com 3 tarefas principais:
+ *      executor cíclico (executor.c) com quadro de 500 ms:
  *
  *      Tarefa 1 - Leitura da temperatura via DMA (meio segundo)
- *      Tarefa 2 - Exibição da temperatura e tendência no OLED
- *      Tarefa 3 - Análise da tendência da temperatura
+ *      Tarefa 2 - Análise da tendência da temperatura
+ *      Tarefa 3 - Exibição da temperatura e tendência no OLED
+ *      Tarefa 4 - Cor da matriz NeoPixel por tendência
+ *      Tarefa 5 - Alerta de temperatura na matriz NeoPixel
  *
- *      O sistema utiliza watchdog para segurança, terminal USB
- *      para monitoramento e display OLED para visualização direta.
+ *      As tarefas rodam em contexto de thread no laço do
+ *      executor, cada uma com período, fase e orçamento
+ *      declarados na tabela 'tarefas[]'. Só a Tarefa 1 é
+ *      periódica de fato: as demais assinam o tópico da etapa
+ *      anterior (topicos.c) e só rodam quando há dado novo.
+ *
+ *      O sistema utiliza watchdog para segurança (alimentado pelo
+ *      supervisor só quando todas as tarefas deram batida no
+ *      prazo), terminal USB para monitoramento e display OLED
+ *      para visualização direta. Pelo USB, o console
+ *      (console.c) lê e ajusta os parâmetros em execução.
  *
  *  
  *  Data: 12/05/2025
@@ -21,162 +32,222 @@
 
 #include <stdio.h>
 #include "pico/stdlib.h"
-#include "hardware/watchdog.h"
 
 #include "setup.h"
+#include "ssd1306.h"
+#include "barramento_i2c.h"
+#include "aquisicao.h"
+#include "executor.h"
+#include "instrumentacao.h"
+#include "telemetria.h"
 #include "tarefa1_temp.h"
 #include "tarefa2_display.h"
 #include "tarefa3_tendencia.h"
 #include "tarefa4_controla_neopixel.h"
+#include "historico.h"
+#include "energia.h"
+#include "supervisor.h"
+#include "grafico_oled.h"
+#include "parametros.h"
+#include "console.h"
+#include "topicos.h"
+#include "boot.h"
+#include "memoria.h"
 #include "neopixel_driver.h"
+#include "animacao.h"
 #include "testes_cores.h"  
 #include "pico/stdio_usb.h"
 
+// Com 1, o executor só começa depois que o host abre a porta USB (como antes)
+#ifndef TEMPCYCLE_ESPERAR_USB
+#define TEMPCYCLE_ESPERAR_USB 0
+#endif
+
+
+
 
+// Registro publicado pela tendência: a média que a originou e o resultado
+typedef struct {
+    int32_t temp_mC;
+    resultado_tendencia_t res;
+} registro_tendencia_t;
 
+// Encadeamento: aquisição → amostra → tendência → (OLED, estado → matriz); amostra → alerta
+static resultado_aquisicao_t ultima_janela;
+static registro_tendencia_t ultima_tendencia;
+static tendencia_t ultimo_estado;
+static topico_t topico_amostra = TOPICO("amostra", ultima_janela);
+static topico_t topico_tendencia = TOPICO("tendencia", ultima_tendencia);
+static topico_t topico_estado = TOPICO("estado", ultimo_estado);   // Só muda com a tendência
 
-float media;
-tendencia_t t;
-volatile bool leitura_temp_concluida = false;
-absolute_time_t ini_tarefa1, fim_tarefa1, ini_tarefa2, fim_tarefa2, ini_tarefa3, fim_tarefa3, ini_tarefa4, fim_tarefa4;
-struct repeating_timer timer1, timer2, timer3, timer4, timer5;
+static int32_t alerta_limiar_mC = 1000;   // Alerta abaixo de 1 °C
 
 
 /*******************************/
-bool tarefa_1(struct repeating_timer *unused){
+void tarefa_1(void){
 // --- Tarefa 1: Leitura de temperatura via DMA ---
-        static bool ciclo_finalizado = false;
+    resultado_aquisicao_t janela;
+    if (!aquisicao_proxima_janela(&janela)) return;
 
-    if (!ciclo_finalizado) {
-        ciclo_finalizado = tarefa1_obter_media_temp(&cfg_temp, DMA_TEMP_CHANNEL);
-    } else {
-        media = tarefa1_termina();
-        ciclo_finalizado = false;
-
-        printf("Temperatura: %.2f °C\n", media);
+    telemetria_registrar(TELEM_TEMPERATURA, 1, janela.temp_mC, 0);
+    telemetria_registrar(TELEM_ROBUSTA, 1, janela.temp_mediana_mC, janela.temp_desvio_mC);
+    historico_registrar(janela.temp_mC, (uint32_t)(janela.timestamp_us / 1000u));
+    grafico_adicionar(janela.temp_mC);
 
-        if (!leitura_temp_concluida) {
-            leitura_temp_concluida = true;
-            printf(">> Primeira leitura concluída. Tarefas 2 a 5 liberadas.\n");
-        }
+    if (topico_versao(&topico_amostra) == 0) {
+        boot_primeira_amostra();
+        telemetria_registrar(TELEM_EVENTO, 1, TELEM_EV_PRIMEIRA_LEITURA, 0);
     }
-
-    return true;
+    topico_publicar(&topico_amostra, &janela);
 }
 /*******************************/
-bool tarefa_2(struct repeating_timer *unused)
+void tarefa_2(void)
 {
-    // --- Tarefa 3: Análise da tendência térmica ---
-        static int contador = 0;
-    if (!leitura_temp_concluida) return true;
+    // --- Tarefa 3: Análise da tendência térmica (a cada amostra nova) ---
+    resultado_aquisicao_t janela;
+    registro_tendencia_t r;
 
-    if (++contador < 3) return true;
-    contador = 0;
+    topico_ler(&topico_amostra, &janela);
+    r.temp_mC = janela.temp_mC;
+    tendencia_t t = tarefa3_atualizar(janela.temp_mC, &r.res);
+    telemetria_registrar(TELEM_TENDENCIA, 2, t, 0);
 
-    ini_tarefa3 = get_absolute_time();
-    t = tarefa3_analisa_tendencia(media);
-    fim_tarefa3 = get_absolute_time();
-
-    int64_t tempo3_us = absolute_time_diff_us(ini_tarefa3, fim_tarefa3);
-    printf("Tarefa 2: Tendência → %s | T3: %.3fs\n", tendencia_para_texto(t), tempo3_us / 1e6);
-    return true;
+    topico_publicar(&topico_tendencia, &r);
+    topico_publicar_se_mudou(&topico_estado, &t);
 }
 /*******************************/
-bool tarefa_3(struct repeating_timer *unused)
+void tarefa_3(void)
 {
-        // --- Tarefa 2: Exibição no OLED ---
-        static int contador = 0;
-    if (!leitura_temp_concluida) return true;
-
-    if (++contador < 3) return true;
-    contador = 0;
+        // --- Tarefa 2: Exibição no OLED (a cada tendência publicada) ---
+    registro_tendencia_t r;
+    topico_ler(&topico_tendencia, &r);
 
-    ini_tarefa2 = get_absolute_time();
-    tarefa2_exibir_oled(media, t);
-    fim_tarefa2 = get_absolute_time();
-
-    int64_t tempo2_us = absolute_time_diff_us(ini_tarefa2, fim_tarefa2);
-    printf("Tarefa 3: Display OLED | T2: %.3fs\n", tempo2_us / 1e6);
-    return true;
+    tarefa2_exibir_oled(r.temp_mC, r.res.tendencia);
 }
 /*******************************/
-bool tarefa_4(struct repeating_timer *unused)
+void tarefa_4(void)
 {
-// --- Tarefa 4: Cor da matriz NeoPixel por tendência ---
-        static int contador = 0;
-    if (!leitura_temp_concluida) return true;
-
-    if (++contador < 3) return true;
-    contador = 0;
+// --- Tarefa 4: Cor da matriz NeoPixel (só quando a tendência muda) ---
+    tendencia_t e;
+    topico_ler(&topico_estado, &e);
 
-    ini_tarefa4 = get_absolute_time();
-    tarefa4_matriz_cor_por_tendencia(t);
-    fim_tarefa4 = get_absolute_time();
-
-    int64_t tempo4_us = absolute_time_diff_us(ini_tarefa4, fim_tarefa4);
-    printf("Tarefa 4: NeoPixel | T4: %.3fs\n", tempo4_us / 1e6);
-    return true;
+    tarefa4_matriz_cor_por_tendencia(e);
 }
-bool tarefa_5(struct repeating_timer *unused)
+void tarefa_5(void)
 {
 // --- Tarefa 5: Extra ---
-        static int contador = 0;
-    static bool estado = false;
-
-    if (!leitura_temp_concluida) return true;
-
-    if (++contador < 3) return true;
-    contador = 0;
-
-    if (media < 1.0f) {
-        if (estado) {
-            npClear();
-        } else {
-            npSetAll(COR_BRANCA);
-        }
-        npWrite();
-        estado = !estado;
+    // Alerta (mediana abaixo do limiar, um pico isolado não dispara): branco
+    // piscando sobre a cor da tendência
+    static const anim_efeito_t alerta = { ANIM_PISCA, COR_BRANCA, 750, true };
+    resultado_aquisicao_t janela;
+
+    topico_ler(&topico_amostra, &janela);
+    // Sem amostras do sensor a mediana fica em 0: não é leitura, mantém o estado
+    if (!(janela.mascara & (1u << ADC_CANAL_TEMP))) return;
+    if (janela.temp_mediana_mC < alerta_limiar_mC) {
+        anim_iniciar(ANIM_CAMADA_ALERTA, &alerta, 0);
     } else {
-        npClear();
-        npWrite();
+        anim_parar(ANIM_CAMADA_ALERTA);
     }
+}
 
-    return true;
+/**
+ * @brief Folga para a flash: o menor entre o tempo até o próximo quadro
+ *        e o tempo até a próxima IRQ de bloco do ADC.
+ */
+static uint32_t folga_flash_us(void) {
+    uint32_t folga = executor_folga_us();
+    uint32_t ate_bloco = tarefa1_folga_us();
+    return ate_bloco < folga ? ate_bloco : folga;
 }
 
-int main() {
-    setup();  // Inicializações: ADC, DMA, interrupções, OLED, etc.
+/**
+ * @brief Trabalho ocioso do executor: drena a telemetria (USB e rede), conclui o
+ *        envio do OLED e da matriz por DMA, envia as colunas novas do
+ *        gráfico, avança a gravação do
+ *        histórico e atende o console pelo USB. Sem nada pendente,
+ *        dorme até o próximo quadro (modo de economia).
+ */
+static void ocioso(void) {
+    supervisor_verificar();
+    telemetria_drenar();
+#if TEMPCYCLE_WIFI
+    rede_servico();
+#endif
+    ssd1306_flush_poll();
+    grafico_poll();
+    efeito_tick(to_ms_since_boot(get_absolute_time()));
+    npPoll();
+    historico_servico(folga_flash_us());
+
+    // Relatórios do boot quando o host abre a porta (o boot não espera por ele)
+    static bool boot_relatado = false;
+    if (!boot_relatado && stdio_usb_connected()) {
+        boot_relatado = true;
+        boot_relatorio();
+        executor_relatorio();
+        supervisor_relatorio();
+    }
+    console_poll();
+
+    if (!ssd1306_flush_ocupado() && !barramento_i2c_ocupado() && npQuadroConcluido() &&
+        !historico_pendente() && !grafico_pendente()) {
+        energia_dormir(executor_folga_us());
+    }
+}
 
-   // while (!stdio_usb_connected()) {
-   //     sleep_ms(100);
-   // }
+// Tabela do executor (ordem = ordem de execução dentro do quadro; quem publica vem antes
+// de quem assina, e a amostra nova chega à tela e à matriz no mesmo quadro)
+static tarefa_ciclica_t tarefas[] = {
+    //  nome         função    T (ms) fase (ms) orçamento (µs) gatilho
+    { "aquisicao",  tarefa_1,   500,     0,      2000,  NULL },
+    { "tendencia",  tarefa_2,   500,     0,      2000,  &topico_amostra },
+    { "oled",       tarefa_3,   500,     0,     20000,  &topico_tendencia },
+    { "neopixel",   tarefa_4,   500,     0,      5000,  &topico_estado },
+    { "alerta",     tarefa_5,   500,     0,      5000,  &topico_amostra },
+};
+
+// Novo período: confere a aquisição com a janela e refaz a tabela de quadros
+static bool aplicar_periodos(void) {
+    if (!setup_periodo_aquisicao(tarefas[0].periodo_ms, false)) return false;
+    return executor_configurar(tarefas, count_of(tarefas));
+}
 
-    //Ativa o watchdog com timeout de 2 segundos
-    //watchdog_enable(2000, 1);
+// Períodos em múltiplos de EXECUTOR_QUADRO_MENOR_MS; o executor recusa os que não cabem
+static const parametro_t parametros_main[] = {
+    { "T.aquisicao", PARAM_U32, &tarefas[0].periodo_ms, 500, 8000, aplicar_periodos, "periodo da tarefa (ms)" },
+    { "T.tendencia", PARAM_U32, &tarefas[1].periodo_ms, 500, 8000, aplicar_periodos, "periodo da tarefa (ms)" },
+    { "T.oled",      PARAM_U32, &tarefas[2].periodo_ms, 500, 8000, aplicar_periodos, "periodo da tarefa (ms)" },
+    { "T.neopixel",  PARAM_U32, &tarefas[3].periodo_ms, 500, 8000, aplicar_periodos, "periodo da tarefa (ms)" },
+    { "T.alerta",    PARAM_U32, &tarefas[4].periodo_ms, 500, 8000, aplicar_periodos, "periodo da tarefa (ms)" },
+    { "alerta.mC",   PARAM_I32, &alerta_limiar_mC, -40000, 125000, NULL, "mediana abaixo disso pisca a matriz" },
+};
 
-    while (true) {
-         setup();
+int main() {
+    setup();  // Etapas do boot, uma vez: USB, parâmetros, ADC/DMA, OLED, matriz, etc.
 
-    // Aguarda conexão usb para printf funcionar corretamente
+#if TEMPCYCLE_ESPERAR_USB
+    // Opcional: segura o executor até o host abrir a porta (a aquisição já está rodando)
     while (!stdio_usb_connected()) {
         sleep_ms(100);
     }
+#endif
 
-    // Desativado por segurança durante testes
-    // Watchdog_enable(2000, 1);
-
-    // Timers
-    add_repeating_timer_ms(500, tarefa_1, NULL, &timer1);
-    add_repeating_timer_ms(500, tarefa_2, NULL, &timer2);
-    add_repeating_timer_ms(500, tarefa_3, NULL, &timer3);
-    add_repeating_timer_ms(500, tarefa_4, NULL, &timer4);
-    add_repeating_timer_ms(500, tarefa_5, NULL, &timer5);
-
-    while (true) {
-        // Watchdog_update(); se watchdog estiver habilitado
-        tight_loop_contents();
+    // Executor cíclico: período, fase e orçamento de cada tarefa (períodos salvos pelo console valem aqui)
+    parametros_registrar(parametros_main, count_of(parametros_main));
+    if (!setup_periodo_aquisicao(tarefas[0].periodo_ms, true)) {
+        printf(">> Aviso: aq.janela_us não é múltiplo de T.aquisicao; janelas serão perdidas.\n");
+    }
+    if (!executor_configurar(tarefas, count_of(tarefas))) {
+        printf(">> Aviso: escalonamento não cabe nos quadros.\n");
     }
+    instr_nomear(INSTR_IRQ_DMA, "irq_dma");
+    executor_definir_ocioso(ocioso);
+
+    // Watchdog só a partir daqui: as tarefas já são fontes do supervisor
+    supervisor_ativar();
+    memoria_marcar_boot();  // Daqui em diante o heap não deve crescer
+    executor_executar();  // Não retorna
 
     return 0;
 }
-}
\ No newline at end of file
@@ -0,0 +1,228 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: memoria.c
+ *  Projeto: TempCycleDMA
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Implementação do orçamento de RAM a partir dos
+ *      símbolos do linker do SDK (memmap_default.ld):
+ *
+ *         SCRATCH_Y  dados __scratch_y | pilha do núcleo 0
+ *         SCRATCH_X  dados __scratch_x | pilha do núcleo 1
+ *         RAM        .data | .bss | heap → __StackLimit
+ *
+ *      A reserva do linker (__StackBottom, __StackOneBottom)
+ *      é o tamanho nominal da pilha; o que ela pode crescer de
+ *      fato vai até os dados do scratch do mesmo banco (abaixo
+ *      do SCRATCH_Y está a pilha do núcleo 1). O perfil
+ *      TEMPCYCLE_FAST_PATH põe os acumuladores da aquisição
+ *      justamente nesse espaço.
+ *
+ *  Relacionamento:
+ *      - Pintura na primeira etapa do boot ('setup.c'), marca
+ *        do heap antes do executor ('main.c')
+ *      - Entradas de IRQ em 'irq_handlers.c' e
+ *        'barramento_i2c.c'
+ *      - Relatório pelo console ('console.c', comando 'm')
+ *
+ *
+ *  Data: 14/10/2026
+ * ------------------------------------------------------------
+ */
+
+#include <malloc.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "memoria.h"
+#include "caminho_rapido.h"
+#include "tarefa1_temp.h"
+#include "reducao.h"
+#include "ssd1306_i2c.h"
+#include "historico.h"
+#include "telemetria.h"
+#include "fila_janelas.h"
+#include "instrumentacao.h"
+#include "tarefa3_tendencia.h"
+#include "neopixel_driver.h"
+#include "bench.h"
+#if TEMPCYCLE_WIFI
+#include "lwipopts.h"
+#endif
+
+extern char __data_start__, __data_end__, __bss_start__, __bss_end__;
+extern char __end__, __HeapLimit, __StackLimit;
+extern char __scratch_x_start__, __scratch_x_end__, __scratch_y_start__, __scratch_y_end__;
+extern char __StackTop, __StackBottom, __StackOneTop, __StackOneBottom;
+
+// Folga deixada abaixo do ponteiro de pilha ao pintar (frame do memset)
+#define MARGEM_PINTURA 64u
+
+typedef struct {
+    const char *nome;
+    char *base;           // Fim dos dados do scratch: até onde a pilha pode crescer
+    char *reservado;      // Início da reserva do linker
+    char *topo;
+} pilha_t;
+
+static const pilha_t pilhas[] = {
+    { "nucleo 0", &__scratch_y_end__, &__StackBottom,    &__StackTop },
+#if TEMPCYCLE_DUAL_CORE
+    { "nucleo 1", &__scratch_x_end__, &__StackOneBottom, &__StackOneTop },
+#endif
+};
+
+typedef struct {
+    uint32_t sp_min, sp_max;   // Ponteiro de pilha na entrada: mais fundo e mais raso
+    uint32_t n;
+} irq_pilha_t;
+
+static const char *const nomes_irq[MEMORIA_NUM_IRQS] = {
+    [MEMORIA_IRQ_DMA] = "irq dma",
+    [MEMORIA_IRQ_I2C] = "irq i2c",
+};
+
+static irq_pilha_t irqs[MEMORIA_NUM_IRQS];
+
+static uint32_t heap_boot = 0;
+static bool boot_marcado = false;
+
+// Buffers estáticos grandes, com os tamanhos dos cabeçalhos de cada módulo
+typedef struct {
+    const char *nome;
+    uint32_t bytes;
+} buffer_estatico_t;
+
+static const buffer_estatico_t buffers[] = {
+    { "adc buffer_temp",    TEMP_BUFFER_AMOSTRAS * sizeof(uint16_t) },
+    { "adc histogramas",    2 * sizeof(reducao_hist_t) },
+    { "fila de janelas",    FILA_JANELAS_CAPACIDADE * sizeof(resultado_aquisicao_t) },
+    { "oled ssd",           ssd1306_buffer_length },
+    { "oled enviado",       ssd1306_buffer_length },
+    { "oled cadeia tx",     SSD1306_TX_PALAVRAS * sizeof(uint16_t) },
+    { "historico setores",  HISTORICO_RAM_BYTES },
+    { "telemetria anel",    TELEMETRIA_CAPACIDADE * sizeof(registro_telemetria_t) },
+    { "instrumentacao",     INSTR_NUM_PONTOS * sizeof(instr_ponto_t) },
+    { "tendencia anel",     TENDENCIA_JANELA_MAX * sizeof(int32_t) },
+    { "neopixel quadros",   2 * LED_COUNT * sizeof(uint32_t) + 256 },   // + LUT de brilho
+    { "bench casos",        BENCH_BLOCO * sizeof(uint16_t) + ssd1306_buffer_length },
+#if TEMPCYCLE_WIFI
+    { "lwip heap",          MEM_SIZE },
+#endif
+};
+
+static inline char *sp_atual(void) {
+    char *sp;
+    __asm volatile ("mov %0, sp" : "=r" (sp));
+    return sp;
+}
+
+// Início da pintura: primeira palavra alinhada depois dos dados do scratch
+static uint32_t *inicio_pintura(const pilha_t *p) {
+    return (uint32_t *)(((uintptr_t)p->base + 3u) & ~(uintptr_t)3u);
+}
+
+// Primeira palavra já usada, subindo da base (o topo se nada foi usado)
+static char *marca_dagua(const pilha_t *p) {
+    const uint32_t *w = inicio_pintura(p);
+    while ((const char *)w < p->topo && *w == MEMORIA_PADRAO) w++;
+    return (char *)w;
+}
+
+static uint32_t heap_pico(void) {
+    struct mallinfo mi = mallinfo();
+    return (uint32_t)mi.arena;
+}
+
+void memoria_pintar_pilhas(void) {
+    // O padrão repete o mesmo byte, então o memset serve
+    uint32_t *ini = inicio_pintura(&pilhas[0]);
+    char *limite = sp_atual() - MARGEM_PINTURA;
+    if (limite > (char *)ini) memset(ini, (uint8_t)MEMORIA_PADRAO, (size_t)(limite - (char *)ini));
+#if TEMPCYCLE_DUAL_CORE
+    // Núcleo 1 ainda parado: a pilha inteira
+    ini = inicio_pintura(&pilhas[1]);
+    memset(ini, (uint8_t)MEMORIA_PADRAO, (size_t)(pilhas[1].topo - (char *)ini));
+#endif
+
+    for (int i = 0; i < MEMORIA_NUM_IRQS; i++) {
+        irqs[i].sp_min = UINT32_MAX;
+        irqs[i].sp_max = 0;
+        irqs[i].n = 0;
+    }
+}
+
+void memoria_marcar_boot(void) {
+    heap_boot = heap_pico();
+    boot_marcado = true;
+}
+
+void CAMINHO_RAPIDO(memoria_irq_entrada)(uint8_t irq) {
+    uint32_t sp = (uint32_t)(uintptr_t)sp_atual();
+    irq_pilha_t *p = &irqs[irq];
+    if (sp < p->sp_min) p->sp_min = sp;
+    if (sp > p->sp_max) p->sp_max = sp;
+    p->n++;
+}
+
+// Pilha que contém o endereço (NULL se nenhuma)
+static const pilha_t *pilha_de(uint32_t endereco) {
+    for (unsigned i = 0; i < count_of(pilhas); i++) {
+        if (endereco >= (uintptr_t)pilhas[i].base && endereco <= (uintptr_t)pilhas[i].topo) {
+            return &pilhas[i];
+        }
+    }
+    return NULL;
+}
+
+void memoria_relatorio(void) {
+    printf("Memoria: .data %lu B (com o codigo na SRAM) | .bss %lu B | scratch_x %lu B | scratch_y %lu B\n",
+           (unsigned long)(&__data_end__ - &__data_start__), (unsigned long)(&__bss_end__ - &__bss_start__),
+           (unsigned long)(&__scratch_x_end__ - &__scratch_x_start__),
+           (unsigned long)(&__scratch_y_end__ - &__scratch_y_start__));
+
+    struct mallinfo mi = mallinfo();
+    uint32_t pico = (uint32_t)mi.arena;
+    printf("  heap: pico %lu B (reserva %lu B), em uso %lu B, %lu B livres ate o fim da RAM\n",
+           (unsigned long)pico, (unsigned long)(&__HeapLimit - &__end__), (unsigned long)mi.uordblks,
+           (unsigned long)(&__StackLimit - (&__end__ + pico)));
+    if (boot_marcado && pico > heap_boot) {
+        printf("  >> Aviso: heap cresceu %lu B depois do boot\n", (unsigned long)(pico - heap_boot));
+    }
+
+    char *marcas[count_of(pilhas)];
+    for (unsigned i = 0; i < count_of(pilhas); i++) {
+        const pilha_t *p = &pilhas[i];
+        marcas[i] = marca_dagua(p);
+        uint32_t folga = (uint32_t)(marcas[i] - (char *)inicio_pintura(p));
+        printf("  pilha %s: usa %5lu B de %lu reservados (%lu ate os dados do scratch) | folga %lu B%s\n",
+               p->nome, (unsigned long)(p->topo - marcas[i]), (unsigned long)(p->topo - p->reservado),
+               (unsigned long)(p->topo - p->base), (unsigned long)folga,
+               folga < MEMORIA_FOLGA_MIN ? "  << pouca folga" : "");
+    }
+
+    // IRQ e as que ela interromper não descem além da marca do núcleo: a partir
+    // da entrada mais rasa, sobram no máximo sp_max − marca bytes para elas
+    for (int i = 0; i < MEMORIA_NUM_IRQS; i++) {
+        const irq_pilha_t *q = &irqs[i];
+        const pilha_t *p = q->n ? pilha_de(q->sp_min) : NULL;
+        if (!p) {
+            printf("  %s: sem entradas\n", nomes_irq[i]);
+            continue;
+        }
+        char *marca = marcas[p - pilhas];
+        printf("  %s (%s): entrada a %lu..%lu B do topo em %lu vezes | ela e as aninhadas <= %lu B\n",
+               nomes_irq[i], p->nome, (unsigned long)((uintptr_t)p->topo - q->sp_max),
+               (unsigned long)((uintptr_t)p->topo - q->sp_min), (unsigned long)q->n,
+               (unsigned long)(q->sp_max - (uintptr_t)marca));
+    }
+
+    uint32_t total = 0;
+    printf("  buffers estaticos:\n");
+    for (unsigned i = 0; i < count_of(buffers); i++) {
+        printf("    %-18s %6lu B\n", buffers[i].nome, (unsigned long)buffers[i].bytes);
+        total += buffers[i].bytes;
+    }
+    printf("    %-18s %6lu B\n", "total", (unsigned long)total);
+}
@@ -0,0 +1,74 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: memoria.h
+ *  Projeto: TempCycleDMA
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Orçamento de RAM: marca d'água das pilhas, pico do
+ *      heap e os buffers estáticos grandes.
+ *
+ *      No boot as pilhas são pintadas com MEMORIA_PADRAO (a
+ *      do núcleo 0 até um pouco abaixo do ponteiro atual, a
+ *      do núcleo 1 inteira, antes de ele ser lançado). A
+ *      marca d'água é a primeira palavra repintada; como as
+ *      IRQs usam a pilha do núcleo em que rodam, ela já
+ *      inclui as interrupções. Cada IRQ registra ainda o
+ *      ponteiro de pilha na entrada, o que dá um limite para
+ *      a pilha da própria IRQ.
+ *
+ *      O heap não deve crescer depois do boot: o relatório
+ *      compara o pico (o que o malloc já pediu ao sbrk) com o
+ *      do fim do boot e avisa se mudou.
+ *
+ *      Os dados só são calculados e impressos quando pedidos
+ *      pelo USB (comando 'm').
+ *
+ *
+ *  Data: 14/10/2026
+ * ------------------------------------------------------------
+ */
+
+#ifndef MEMORIA_H
+#define MEMORIA_H
+
+#include <stdint.h>
+#include "pico.h"
+
+#define MEMORIA_PADRAO 0xA5A5A5A5u   // Palavra da pintura das pilhas
+#define MEMORIA_FOLGA_MIN 256u       // Folga de pilha abaixo disso sai com aviso
+
+// IRQs com a profundidade de entrada registrada
+enum {
+    MEMORIA_IRQ_DMA,
+    MEMORIA_IRQ_I2C,
+    MEMORIA_NUM_IRQS
+};
+
+/**
+ * @brief Pinta as pilhas. Primeira etapa do boot: o núcleo 1 ainda
+ *        não pode estar rodando.
+ */
+void memoria_pintar_pilhas(void);
+
+/**
+ * @brief Guarda o heap do fim do boot (referência do aviso de crescimento).
+ */
+void memoria_marcar_boot(void);
+
+/**
+ * @brief Registra o ponteiro de pilha na entrada de uma IRQ.
+ *
+ * No build de host não há pilha pintada e a chamada some.
+ */
+#if PICO_ON_DEVICE
+void memoria_irq_entrada(uint8_t irq);
+#else
+static inline void memoria_irq_entrada(uint8_t irq) { (void)irq; }
+#endif
+
+/**
+ * @brief Imprime seções, pilhas, IRQs, heap e buffers estáticos.
+ */
+void memoria_relatorio(void);
+
+#endif  // MEMORIA_H
@@ -0,0 +1,210 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: parametros.c
+ *  Projeto: TempCycleDMA
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Implementação do registro de parâmetros.
+ *
+ *      Setor salvo (logo abaixo do histórico):
+ *          cabeçalho { magica, n, hash FNV-1a das entradas }
+ *          n × { FNV-1a do nome, valor }
+ *
+ *      O setor validado é lido direto pelo XIP; não há cópia
+ *      em RAM. A gravação apaga e regrava o setor numa única
+ *      chamada de flash_safe_execute (o núcleo 1, se houver,
+ *      fica pausado até o fim).
+ *
+ *  Relacionamento:
+ *      - Tabelas registradas por 'setup.c' e 'main.c'
+ *      - Usado pelo console em 'console.c'
+ *      - Área da flash vizinha à de 'historico.c'
+ *
+ *
+ *  Data: 14/10/2026
+ * ------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "pico/flash.h"
+#include "hardware/flash.h"
+#include "parametros.h"
+#include "historico.h"
+
+#define PARAMETROS_MAGICA 0x31504354u   // "TCP1"
+#define PARAMETROS_OFFSET (PICO_FLASH_SIZE_BYTES - (HISTORICO_SETORES + 1u) * FLASH_SECTOR_SIZE)
+#define TRAVA_TIMEOUT_MS 10u
+
+typedef struct {
+    uint32_t magica;
+    uint32_t n;
+    uint32_t hash;
+    uint32_t reservado;
+} cabecalho_t;
+
+typedef struct {
+    uint32_t id;                // FNV-1a do nome
+    int32_t valor;
+} entrada_t;
+
+typedef struct {
+    cabecalho_t cab;
+    entrada_t entradas[PARAMETROS_MAX];
+} imagem_t;
+
+// A gravação é feita em páginas inteiras
+#define IMAGEM_BYTES ((sizeof(imagem_t) + FLASH_PAGE_SIZE - 1) / FLASH_PAGE_SIZE * FLASH_PAGE_SIZE)
+
+static const parametro_t *registro[PARAMETROS_MAX];
+static uint8_t n_registro = 0;
+static const imagem_t *salvo = NULL;   // Setor válido no XIP (NULL = nada salvo)
+static union {
+    imagem_t imagem;
+    uint8_t bytes[IMAGEM_BYTES];
+} escrita;
+
+static uint32_t fnv1a(const void *dados, uint32_t n) {
+    const uint8_t *p = dados;
+    uint32_t h = 2166136261u;
+    for (uint32_t i = 0; i < n; i++) h = (h ^ p[i]) * 16777619u;
+    return h;
+}
+
+static inline uint32_t id_nome(const char *nome) {
+    return fnv1a(nome, (uint32_t)strlen(nome));
+}
+
+int32_t parametros_ler(const parametro_t *p) {
+    switch (p->tipo) {
+        case PARAM_BOOL: return *(const bool *)p->valor;
+        case PARAM_U8:   return *(const uint8_t *)p->valor;
+        case PARAM_U16:  return *(const uint16_t *)p->valor;
+        case PARAM_U32:  return (int32_t)*(const uint32_t *)p->valor;
+        case PARAM_I32:  return *(const int32_t *)p->valor;
+    }
+    return 0;
+}
+
+static void escrever(const parametro_t *p, int32_t v) {
+    switch (p->tipo) {
+        case PARAM_BOOL: *(bool *)p->valor = v != 0; break;
+        case PARAM_U8:   *(uint8_t *)p->valor = (uint8_t)v; break;
+        case PARAM_U16:  *(uint16_t *)p->valor = (uint16_t)v; break;
+        case PARAM_U32:  *(uint32_t *)p->valor = (uint32_t)v; break;
+        case PARAM_I32:  *(int32_t *)p->valor = v; break;
+    }
+}
+
+static inline bool na_faixa(const parametro_t *p, int64_t v) {
+    return v >= p->min && v <= p->max;
+}
+
+// === Flash ===
+
+static const imagem_t *setor_valido(void) {
+    const imagem_t *s = (const imagem_t *)(uintptr_t)(XIP_BASE + PARAMETROS_OFFSET);
+    if (s->cab.magica != PARAMETROS_MAGICA || s->cab.n > PARAMETROS_MAX) return NULL;
+    if (fnv1a(s->entradas, s->cab.n * sizeof(entrada_t)) != s->cab.hash) return NULL;
+    return s;
+}
+
+uint32_t parametros_carregar(void) {
+    salvo = setor_valido();
+    return salvo ? salvo->cab.n : 0;
+}
+
+// Roda com IRQs desligadas e o outro núcleo fora da flash
+static void gravar_setor(void *param) {
+    flash_range_erase(PARAMETROS_OFFSET, FLASH_SECTOR_SIZE);
+    if (param) flash_range_program(PARAMETROS_OFFSET, param, IMAGEM_BYTES);
+}
+
+bool parametros_salvar(void) {
+    memset(escrita.bytes, 0xFF, sizeof(escrita.bytes));
+    for (uint8_t i = 0; i < n_registro; i++) {
+        escrita.imagem.entradas[i].id = id_nome(registro[i]->nome);
+        escrita.imagem.entradas[i].valor = parametros_ler(registro[i]);
+    }
+    escrita.imagem.cab.magica = PARAMETROS_MAGICA;
+    escrita.imagem.cab.n = n_registro;
+    escrita.imagem.cab.hash = fnv1a(escrita.imagem.entradas, n_registro * sizeof(entrada_t));
+    escrita.imagem.cab.reservado = 0;
+
+    if (flash_safe_execute(gravar_setor, escrita.bytes, TRAVA_TIMEOUT_MS) != PICO_OK) return false;
+    salvo = setor_valido();
+    return salvo != NULL;
+}
+
+bool parametros_apagar(void) {
+    if (flash_safe_execute(gravar_setor, NULL, TRAVA_TIMEOUT_MS) != PICO_OK) return false;
+    salvo = NULL;
+    return true;
+}
+
+// === Registro ===
+
+bool parametros_registrar(const parametro_t *tabela, uint8_t n) {
+    for (uint8_t k = 0; k < n; k++) {
+        const parametro_t *p = &tabela[k];
+        uint8_t i;
+        for (i = 0; i < n_registro; i++) {
+            if (strcmp(registro[i]->nome, p->nome) == 0) break;
+        }
+        if (i == n_registro) {
+            if (n_registro == PARAMETROS_MAX) return false;
+            n_registro++;
+        }
+        registro[i] = p;
+
+        if (!salvo) continue;
+        uint32_t id = id_nome(p->nome);
+        for (uint32_t e = 0; e < salvo->cab.n; e++) {
+            // Fora da faixa (faixa mudou num firmware novo): fica o padrão
+            if (salvo->entradas[e].id == id && na_faixa(p, salvo->entradas[e].valor)) {
+                escrever(p, salvo->entradas[e].valor);
+                break;
+            }
+        }
+    }
+    return true;
+}
+
+const parametro_t *parametros_buscar(const char *nome) {
+    for (uint8_t i = 0; i < n_registro; i++) {
+        if (strcmp(registro[i]->nome, nome) == 0) return registro[i];
+    }
+    return NULL;
+}
+
+resultado_parametro_t parametros_definir(const char *nome, const char *texto) {
+    const parametro_t *p = parametros_buscar(nome);
+    if (!p) return PARAM_DESCONHECIDO;
+
+    char *fim;
+    long long v = strtoll(texto, &fim, 0);
+    if (fim == texto || *fim != '\0') return PARAM_INVALIDO;
+    if (!na_faixa(p, v)) return PARAM_FORA_DA_FAIXA;
+
+    int32_t anterior = parametros_ler(p);
+    escrever(p, (int32_t)v);
+    if (p->aplicar && !p->aplicar()) {
+        escrever(p, anterior);
+        p->aplicar();
+        return PARAM_RECUSADO;
+    }
+    return PARAM_OK;
+}
+
+void parametros_listar(const char *prefixo) {
+    size_t n = prefixo ? strlen(prefixo) : 0;
+    for (uint8_t i = 0; i < n_registro; i++) {
+        const parametro_t *p = registro[i];
+        if (n && strncmp(p->nome, prefixo, n) != 0) continue;
+        printf("  %-16s %8ld  [%ld..%ld]  %s\n", p->nome, (long)parametros_ler(p),
+               (long)p->min, (long)p->max, p->descricao);
+    }
+    printf("  (%u parametros, %s)\n", n_registro, salvo ? "valores salvos na flash" : "nada salvo");
+}
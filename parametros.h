@@ -0,0 +1,101 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: parametros.h
+ *  Projeto: TempCycleDMA
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Registro de parâmetros ajustáveis em execução, com
+ *      gravação opcional na flash.
+ *
+ *      Cada módulo declara uma tabela de 'parametro_t' que
+ *      aponta para as próprias variáveis (as configs de
+ *      'setup.c', os períodos do executor em 'main.c'). O
+ *      console lê e escreve por nome; depois de escrever, a
+ *      função 'aplicar' do parâmetro leva o valor ao módulo
+ *      e pode recusá-lo (o valor anterior volta).
+ *
+ *      Os valores salvos ficam num setor logo abaixo da área
+ *      do histórico, como pares (hash do nome, valor): um
+ *      parâmetro novo ou removido não invalida os demais.
+ *
+ *
+ *  Data: 14/10/2026
+ * ------------------------------------------------------------
+ */
+
+#ifndef PARAMETROS_H
+#define PARAMETROS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define PARAMETROS_MAX 40
+
+typedef enum {
+    PARAM_BOOL,
+    PARAM_U8,
+    PARAM_U16,
+    PARAM_U32,
+    PARAM_I32,
+} tipo_parametro_t;
+
+typedef struct {
+    const char *nome;           // Chave no console e na flash
+    tipo_parametro_t tipo;
+    void *valor;                // Variável do módulo dono
+    int32_t min, max;           // Faixa aceita pelo console e na carga
+    bool (*aplicar)(void);      // Leva o valor ao módulo; false recusa (NULL = vale no próximo uso)
+    const char *descricao;
+} parametro_t;
+
+typedef enum {
+    PARAM_OK,
+    PARAM_DESCONHECIDO,         // Nome não registrado
+    PARAM_INVALIDO,             // Texto não é um número
+    PARAM_FORA_DA_FAIXA,
+    PARAM_RECUSADO,             // 'aplicar' recusou; o valor anterior foi restaurado
+} resultado_parametro_t;
+
+/**
+ * @brief Confere o setor salvo (uma vez, antes dos registros).
+ *
+ * @return número de valores salvos válidos (0 sem setor ou com setor corrompido)
+ */
+uint32_t parametros_carregar(void);
+
+/**
+ * @brief Registra uma tabela; o mesmo nome substitui o registro anterior.
+ *
+ * Os valores salvos na flash são copiados para as variáveis da tabela,
+ * sem chamar 'aplicar': registre antes de configurar os módulos.
+ *
+ * @return false se o registro estiver cheio (as entradas que couberam valem)
+ */
+bool parametros_registrar(const parametro_t *tabela, uint8_t n);
+
+const parametro_t *parametros_buscar(const char *nome);
+int32_t parametros_ler(const parametro_t *p);
+
+/**
+ * @brief Converte o texto (decimal ou 0x...), confere a faixa, escreve e aplica.
+ */
+resultado_parametro_t parametros_definir(const char *nome, const char *texto);
+
+/**
+ * @brief Imprime nome, valor, faixa e descrição de todos (ou dos que começam
+ *        com 'prefixo', se não for NULL).
+ */
+void parametros_listar(const char *prefixo);
+
+/**
+ * @brief Grava os valores atuais na flash (apaga o setor: ~50–400 ms sem
+ *        executar código da flash).
+ */
+bool parametros_salvar(void);
+
+/**
+ * @brief Apaga os valores salvos: o próximo boot volta aos padrões.
+ */
+bool parametros_apagar(void);
+
+#endif  // PARAMETROS_H
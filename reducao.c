@@ -0,0 +1,236 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: reducao.c
+ *  Projeto: TempCycleDMA
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Laço de redução de um bloco do ping-pong e conversão
+ *      em ponto fixo das somas de uma janela. Toda a
+ *      aritmética é inteira: 32 bits por bloco e 64 bits na
+ *      conversão, com arredondamento. Mediana e média aparada
+ *      saem do histograma acumulado na mesma passada.
+ *
+ *  
+ *  Data: 14/10/2026
+ * ------------------------------------------------------------
+ */
+
+#include <stddef.h>
+#include "reducao.h"
+#include "caminho_rapido.h"
+
+// Duas amostras de 16 bits lidas com um único acesso de 32 bits
+typedef uint32_t __attribute__((may_alias)) par_amostras_t;
+
+// Acumuladores do caminho de um canal (ficam em registradores)
+typedef struct {
+    uint32_t soma, soma_q, lo, hi;
+} acum_t;
+
+static inline void contar(reducao_hist_t *h, uint32_t v) {
+    uint32_t k = v - h->base;
+    if (k < REDUCAO_HIST_BINS) {
+        h->bins[k]++;
+    } else if (v < h->base) {
+        h->abaixo++;
+        h->soma_abaixo += v;
+    } else {
+        h->acima++;
+        h->soma_acima += v;
+    }
+}
+
+static inline void somar(acum_t *a, uint32_t v, reducao_hist_t *h) {
+    a->soma += v;
+    a->soma_q += v * v;
+    if (v < a->lo) a->lo = v;
+    if (v > a->hi) a->hi = v;
+    if (h) contar(h, v);
+}
+
+static inline uint8_t somar_fase(reducao_bloco_t *r, uint8_t fase, uint8_t n_canais, uint32_t v,
+                                 reducao_hist_t *h, uint8_t fase_hist) {
+    r->soma[fase] += v;
+    r->soma_q[fase] += v * v;
+    r->cont[fase]++;
+    if (v < r->vmin[fase]) r->vmin[fase] = (uint16_t)v;
+    if (v > r->vmax[fase]) r->vmax[fase] = (uint16_t)v;
+    if (fase == fase_hist) contar(h, v);
+    return ++fase == n_canais ? 0 : fase;
+}
+
+/*
+ * O M0+ só faz acessos alinhados, e a metade do buffer pode começar no
+ * meio de uma palavra: uma amostra avulsa alinha o ponteiro, e então cada
+ * iteração lê duas palavras (quatro amostras) do buffer.
+ */
+uint8_t CAMINHO_RAPIDO(reducao_bloco_hist)(const uint16_t *amostras, uint32_t n, uint8_t n_canais,
+                           uint8_t fase, reducao_hist_t *hist, uint8_t fase_hist,
+                           reducao_bloco_t *r) {
+    for (int i = 0; i < ADC_NUM_CANAIS; i++) {
+        r->soma[i] = 0;
+        r->soma_q[i] = 0;
+        r->cont[i] = 0;
+        r->vmin[i] = 0xFFFF;
+        r->vmax[i] = 0;
+    }
+    if (!hist) fase_hist = ADC_NUM_CANAIS;
+
+    uint32_t i = 0;
+    if (n_canais == 1) {
+        acum_t a = { 0, 0, 0xFFFF, 0 };
+        reducao_hist_t *h = fase_hist == 0 ? hist : NULL;
+
+        if (n && ((uintptr_t)amostras & 2u)) somar(&a, amostras[i++], h);
+        const par_amostras_t *p = (const par_amostras_t *)(amostras + i);
+        for (; i + 4 <= n; i += 4, p += 2) {
+            uint32_t w0 = p[0], w1 = p[1];
+            somar(&a, w0 & 0xFFFFu, h);
+            somar(&a, w0 >> 16, h);
+            somar(&a, w1 & 0xFFFFu, h);
+            somar(&a, w1 >> 16, h);
+        }
+        for (; i < n; i++) somar(&a, amostras[i], h);
+
+        r->soma[0] = a.soma;
+        r->soma_q[0] = a.soma_q;
+        r->cont[0] = n;
+        r->vmin[0] = (uint16_t)a.lo;
+        r->vmax[0] = (uint16_t)a.hi;
+        return 0;
+    }
+
+    // A fase continua de um bloco para o outro, pois o tamanho do
+    // bloco não precisa ser múltiplo do número de canais
+    if (n && ((uintptr_t)amostras & 2u)) {
+        fase = somar_fase(r, fase, n_canais, amostras[i++], hist, fase_hist);
+    }
+    const par_amostras_t *p = (const par_amostras_t *)(amostras + i);
+    for (; i + 2 <= n; i += 2, p++) {
+        uint32_t w = *p;
+        fase = somar_fase(r, fase, n_canais, w & 0xFFFFu, hist, fase_hist);
+        fase = somar_fase(r, fase, n_canais, w >> 16, hist, fase_hist);
+    }
+    if (i < n) fase = somar_fase(r, fase, n_canais, amostras[i], hist, fase_hist);
+    return fase;
+}
+
+uint8_t reducao_bloco(const uint16_t *amostras, uint32_t n, uint8_t n_canais,
+                      uint8_t fase, reducao_bloco_t *r) {
+    return reducao_bloco_hist(amostras, n, n_canais, fase, NULL, ADC_NUM_CANAIS, r);
+}
+
+void CAMINHO_RAPIDO(reducao_hist_iniciar)(reducao_hist_t *h, uint16_t centro) {
+    uint32_t base = centro > REDUCAO_HIST_BINS / 2 ? centro - REDUCAO_HIST_BINS / 2 : 0;
+    if (base > 4096u - REDUCAO_HIST_BINS) base = 4096u - REDUCAO_HIST_BINS;
+    h->base = (uint16_t)base;
+    h->abaixo = h->acima = 0;
+    h->soma_abaixo = h->soma_acima = 0;
+    for (int b = 0; b < REDUCAO_HIST_BINS; b++) h->bins[b] = 0;
+}
+
+// Soma das 'm' menores amostras da janela
+static uint64_t soma_menores(const reducao_hist_t *h, uint32_t m, bool *exata) {
+    if (m <= h->abaixo) {
+        if (m && m < h->abaixo) *exata = false;
+        return h->abaixo ? h->soma_abaixo * m / h->abaixo : 0;
+    }
+    uint64_t soma = h->soma_abaixo;
+    m -= h->abaixo;
+    for (uint32_t b = 0; b < REDUCAO_HIST_BINS && m; b++) {
+        uint32_t k = h->bins[b] < m ? h->bins[b] : m;
+        soma += (uint64_t)k * (h->base + b);
+        m -= k;
+    }
+    if (m) {
+        if (m < h->acima) *exata = false;
+        soma += h->soma_acima * m / h->acima;
+    }
+    return soma;
+}
+
+// Contagem da amostra de ordem 'pos' (0 = a menor)
+static uint32_t amostra_de_ordem(const reducao_hist_t *h, uint32_t pos, bool *exata) {
+    if (pos < h->abaixo) {
+        *exata = false;
+        return (uint32_t)(h->soma_abaixo / h->abaixo);
+    }
+    pos -= h->abaixo;
+    for (uint32_t b = 0; b < REDUCAO_HIST_BINS; b++) {
+        if (pos < h->bins[b]) return h->base + b;
+        pos -= h->bins[b];
+    }
+    *exata = false;
+    return (uint32_t)(h->soma_acima / h->acima);
+}
+
+bool reducao_robusta(const reducao_hist_t *h, reducao_robusta_t *r) {
+    uint32_t n = h->abaixo + h->acima;
+    for (int b = 0; b < REDUCAO_HIST_BINS; b++) n += h->bins[b];
+    if (n == 0) return false;
+
+    bool exata = true;
+    uint32_t meio = amostra_de_ordem(h, (n - 1) / 2, &exata) + amostra_de_ordem(h, n / 2, &exata);
+    r->mediana = (uint16_t)((meio + 1) / 2);
+
+    uint32_t k = n >> REDUCAO_APARO_SHIFT;
+    r->n_aparada = n - 2 * k;
+    r->soma_aparada = soma_menores(h, n - k, &exata) - soma_menores(h, k, &exata);
+    r->na_faixa = exata;
+    return true;
+}
+
+int64_t reducao_media_uV(const calib_temp_t *calib, uint64_t soma, uint32_t n) {
+    uint64_t den = (uint64_t)n << 12;
+    return (int64_t)((soma * calib->vref_uv + den / 2) / den);
+}
+
+/*
+ * T = 27 - (V - V27) / inclinação, sobre a média da janela
+ */
+int32_t reducao_media_mC(const calib_temp_t *calib, uint64_t soma, uint32_t n) {
+    int64_t delta_uv = reducao_media_uV(calib, soma, n) - (int64_t)calib->v27_uv;
+    int64_t num = delta_uv * 1000;
+    int64_t meia = calib->inclinacao_uv_c / 2;
+    int64_t delta_mC = (num >= 0 ? num + meia : num - meia) / (int64_t)calib->inclinacao_uv_c;
+    return 27000 - (int32_t)delta_mC;
+}
+
+// Raiz quadrada inteira (bit a bit, sem divisão)
+static uint32_t raiz_u64(uint64_t v) {
+    uint64_t r = 0, bit = 1ull << 62;
+    while (bit > v) bit >>= 2;
+    while (bit) {
+        if (v >= r + bit) {
+            v -= r + bit;
+            r = (r >> 1) + bit;
+        } else {
+            r >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint32_t)r;
+}
+
+/*
+ * σ² = E[x²] - E[x]², com 16 bits fracionários; o resultado é σ em
+ * contagens × 256. Até ~5 M amostras (10 s a 500 ksps) os deslocamentos
+ * cabem em 64 bits.
+ */
+static uint32_t desvio_q8(uint64_t soma, uint64_t soma_q, uint32_t n) {
+    if (n < 2) return 0;
+    uint64_t m = (soma << 16) / n;
+    uint64_t q = (soma_q << 16) / n;
+    uint64_t m2 = (m * m) >> 16;
+    return q > m2 ? raiz_u64(q - m2) : 0;
+}
+
+uint32_t reducao_desvio_uV(const calib_temp_t *calib, uint64_t soma, uint64_t soma_q, uint32_t n) {
+    uint64_t den = 4096u * 256u;
+    return (uint32_t)(((uint64_t)desvio_q8(soma, soma_q, n) * calib->vref_uv + den / 2) / den);
+}
+
+uint32_t reducao_desvio_mC(const calib_temp_t *calib, uint64_t soma, uint64_t soma_q, uint32_t n) {
+    uint64_t den = 4096ull * 256u * calib->inclinacao_uv_c;
+    return (uint32_t)(((uint64_t)desvio_q8(soma, soma_q, n) * calib->vref_uv * 1000u + den / 2) / den);
+}
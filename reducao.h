@@ -0,0 +1,110 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: reducao.h
+ *  Projeto: TempCycleDMA
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Redução das amostras do ADC e conversão para µV/m°C,
+ *      em C puro (sem acesso a hardware), usada pela Tarefa 1
+ *      no handler do DMA, pelo firmware de benchmark e pelo
+ *      build de host.
+ *
+ *      Uma única passada por bloco dá soma, soma dos
+ *      quadrados, mínimo e máximo de cada canal e, para um
+ *      canal escolhido (o sensor), o histograma das contagens
+ *      brutas de onde saem a mediana e a média aparada da
+ *      janela, em O(n) e sem ordenar.
+ *
+ *
+ *  Data: 14/10/2026
+ * ------------------------------------------------------------
+ */
+
+#ifndef REDUCAO_H
+#define REDUCAO_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "tarefa1_temp.h"
+
+// Parciais de um bloco, indexados pela posição do canal no round-robin
+typedef struct {
+    uint32_t soma[ADC_NUM_CANAIS];
+    uint32_t soma_q[ADC_NUM_CANAIS];   // Soma dos quadrados (256 × 4095² ainda cabe)
+    uint32_t cont[ADC_NUM_CANAIS];
+    uint16_t vmin[ADC_NUM_CANAIS];
+    uint16_t vmax[ADC_NUM_CANAIS];
+} reducao_bloco_t;
+
+// Faixa do histograma, em contagens: a 3,3 V cada contagem vale ~0,8 mV,
+// ~0,5 °C no sensor, então 256 bins cobrem ±60 °C em torno da mediana
+#define REDUCAO_HIST_BINS 256
+#define REDUCAO_APARO_SHIFT 3          // Média aparada: descarta n/8 de cada ponta
+
+// Histograma de uma janela numa faixa em torno da mediana anterior. As
+// amostras fora da faixa só entram contadas e somadas.
+typedef struct {
+    uint16_t base;                     // Contagem do bin 0
+    uint32_t abaixo, acima;
+    uint64_t soma_abaixo, soma_acima;
+    uint32_t bins[REDUCAO_HIST_BINS];
+} reducao_hist_t;
+
+// Estatísticas robustas de uma janela, em contagens brutas
+typedef struct {
+    uint16_t mediana;
+    uint64_t soma_aparada;             // Soma das amostras centrais
+    uint32_t n_aparada;
+    bool     na_faixa;                 // false: mediana ou aparo caíram fora da faixa (aproximados)
+} reducao_robusta_t;
+
+/**
+ * @brief Soma, conta e acha mínimo/máximo de um bloco intercalado.
+ *
+ * @param amostras Contagens de 12 bits, na ordem do FIFO do ADC.
+ * @param n Número de amostras (≤ TEMP_BLOCO_MAX, para a soma dos quadrados caber em 32 bits).
+ * @param n_canais Canais no round-robin (1 usa o caminho sem separação).
+ * @param fase Posição do canal da primeira amostra.
+ * @param r Parciais (zerados aqui).
+ * @return Fase da amostra seguinte ao bloco.
+ */
+uint8_t reducao_bloco(const uint16_t *amostras, uint32_t n, uint8_t n_canais,
+                      uint8_t fase, reducao_bloco_t *r);
+
+/**
+ * @brief Como reducao_bloco(), acumulando também no histograma as
+ *        amostras do canal na posição 'fase_hist' (na mesma passada).
+ *
+ * @param hist Histograma da janela (não é zerado aqui).
+ * @param fase_hist Posição do canal no round-robin (≥ n_canais: nenhum).
+ */
+uint8_t reducao_bloco_hist(const uint16_t *amostras, uint32_t n, uint8_t n_canais,
+                           uint8_t fase, reducao_hist_t *hist, uint8_t fase_hist,
+                           reducao_bloco_t *r);
+
+// Zera o histograma e centra a faixa na contagem dada
+void reducao_hist_iniciar(reducao_hist_t *h, uint16_t centro);
+
+/**
+ * @brief Mediana e média aparada a partir do histograma de uma janela.
+ *
+ * Fora da faixa só a soma é conhecida: essas amostras entram pela média
+ * delas e 'na_faixa' fica false.
+ *
+ * @return false se o histograma está vazio.
+ */
+bool reducao_robusta(const reducao_hist_t *h, reducao_robusta_t *r);
+
+// Média de 'n' contagens somadas em µV, arredondada
+int64_t reducao_media_uV(const calib_temp_t *calib, uint64_t soma, uint32_t n);
+
+// Média de 'n' contagens do sensor interno em m°C, arredondada
+int32_t reducao_media_mC(const calib_temp_t *calib, uint64_t soma, uint32_t n);
+
+// Desvio padrão de 'n' contagens (soma e soma dos quadrados) em µV
+uint32_t reducao_desvio_uV(const calib_temp_t *calib, uint64_t soma, uint64_t soma_q, uint32_t n);
+
+// Desvio padrão do sensor interno em m°C
+uint32_t reducao_desvio_mC(const calib_temp_t *calib, uint64_t soma, uint64_t soma_q, uint32_t n);
+
+#endif  // REDUCAO_H
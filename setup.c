@@ -9,22 +9,28 @@
  *      
  *      - Inicialização do terminal USB (stdio)
  *      - Configuração do ADC e habilitação do sensor interno
- *      - Configuração do canal DMA para leitura da temperatura
- *      - Registro da interrupção do canal DMA 0
+ *      - Configuração dos canais DMA (ping-pong) para leitura
+ *        da temperatura
+ *      - Registro da interrupção dos canais DMA 0 e 1
  *      - Inicialização do display OLED (SSD1306)
  *
- *      A função principal `setup()` deve ser chamada uma única
- *      vez no início do programa, geralmente logo no `main()`,
- *      para garantir que o sistema esteja corretamente preparado
- *      antes de iniciar o executor cíclico.
+ *      A função principal `setup()` roda essas etapas pelo
+ *      sequenciador de 'boot.c': uma única vez, na ordem da
+ *      tabela, com a duração de cada uma medida. A aquisição
+ *      é ligada antes do OLED e da matriz, que iniciam com o
+ *      ADC já amostrando; antes de tudo as pilhas são pintadas
+ *      para a marca d'água de 'memoria.c'.
  *
  *  Relacionamento:
- *      - Define a configuração global `cfg_temp` para uso
- *        posterior na Tarefa 1 (tarefa1_temp.c)
+ *      - Define as configurações globais `cfg_temp` e
+ *        `cfg_aquisicao` para uso na Tarefa 1 (tarefa1_temp.c)
+ *        e `cfg_tendencia` para a Tarefa 3 (tarefa3_tendencia.c)
  *      - Define os símbolos globais `ssd[]` e `area` usados na
  *        Tarefa 2 (tarefa2_display.c)
- *      - Utiliza o handler de interrupção definido em
- *        'irq_handlers.c'
+ *      - Liga a aquisição via 'aquisicao.c', que registra o
+ *        handler de interrupção definido em 'irq_handlers.c'
+ *      - Registra essas configurações em 'parametros.c' (console
+ *        e valores salvos na flash) antes de aplicá-las
  *
  *  
  *  *  Data: 11/05/2025
@@ -36,12 +42,21 @@
 #include "hardware/dma.h"
 #include "hardware/irq.h"
 #include "setup.h"
-#include "irq_handlers.h"
+#include "aquisicao.h"
 #include "ssd1306.h"
 #include "ssd1306_i2c.h"
 #include "hardware/i2c.h"
+#include "barramento_i2c.h"
 #include "pico/binary_info.h"
 #include "neopixel_driver.h"
+#include "historico.h"
+#include "supervisor.h"
+#include "grafico_oled.h"
+#include "parametros.h"
+#include "tarefa4_controla_neopixel.h"
+#include "telemetria_rede.h"
+#include "boot.h"
+#include "memoria.h"
 
 // === buffer de vídeo do oled (tela de 128 x 64) ===
 uint8_t ssd[ssd1306_buffer_length];
@@ -57,43 +72,227 @@ struct render_area area = {
 // === configuração global do canal dma 0 ===
 dma_channel_config cfg_temp;
 
-/**
- * @brief Realiza a configuração inicial do sistema.
- *
- * Esta função inicializa o terminal USB, ADC, sensor de temperatura,
- * canal DMA 0, interrupções e o display OLED.
- */
-void setup() {
-    // Inicializa a comunicação usb para printf()
+// === taxa de amostragem, bloco e janela da tarefa 1 ===
+config_aquisicao_t cfg_aquisicao = CONFIG_AQUISICAO_PADRAO;
+
+// === janela e limiares da tendência (tarefa 3, uma média por janela) ===
+config_tendencia_t cfg_tendencia = CONFIG_TENDENCIA_PADRAO;
+config_energia_t cfg_energia = CONFIG_ENERGIA_PADRAO;
+config_rede_t cfg_rede = CONFIG_REDE_PADRAO;
+
+// === cores da matriz por tendência (tarefa 4) e brilho global ===
+uint32_t cores_tendencia[3] = CORES_TENDENCIA_PADRAO;
+static uint8_t brilho_np = NP_BRILHO_PADRAO;
+
+// Período da tarefa de aquisição ('T.aquisicao', main.c)
+static uint32_t periodo_aquisicao_ms = 500;
+
+// A tarefa lê no máximo uma janela por execução: com a janela num múltiplo
+// do período, cada janela é lida uma vez e as médias chegam a cada janela.
+// Senão o modo contínuo estica a janela até a leitura seguinte, o modo
+// sequenciado sobrescreve janelas e, no núcleo 1, a fila enche.
+static bool janela_cabe(uint32_t janela_us, uint32_t periodo_ms) {
+    return janela_us % (periodo_ms * 1000u) == 0;
+}
+
+// Intervalo entre duas médias da tendência: a janela, ou o período da
+// tarefa se ele for maior (valores salvos incoerentes, ver main.c)
+static bool sincronizar_periodo_tendencia(void) {
+    uint32_t periodo = cfg_aquisicao.janela_us / 1000u;
+    if (periodo < periodo_aquisicao_ms) periodo = periodo_aquisicao_ms;
+    if (periodo == cfg_tendencia.periodo_ms) return false;
+    cfg_tendencia.periodo_ms = periodo;
+    return true;
+}
+
+static bool aplicar_aquisicao(void) {
+    if (!janela_cabe(cfg_aquisicao.janela_us, periodo_aquisicao_ms)) return false;
+    // Sem o sensor as janelas não têm temperatura para a Tarefa 1 publicar
+    if (!(cfg_aquisicao.mascara_canais & (1u << ADC_CANAL_TEMP))) return false;
+    aquisicao_reconfigurar(&cfg_aquisicao);
+    if (sincronizar_periodo_tendencia()) {
+        tarefa3_configurar(&cfg_tendencia);
+    }
+    return true;
+}
+
+bool setup_periodo_aquisicao(uint32_t periodo_ms, bool forcar) {
+    bool cabe = janela_cabe(cfg_aquisicao.janela_us, periodo_ms);
+    if (!cabe && !forcar) return false;
+    periodo_aquisicao_ms = periodo_ms;
+    if (sincronizar_periodo_tendencia()) {
+        tarefa3_configurar(&cfg_tendencia);
+    }
+    return cabe;
+}
+
+static bool aplicar_tendencia(void) {
+    tarefa3_configurar(&cfg_tendencia);   // Descarta o histórico do ajuste
+    return true;
+}
+
+static bool aplicar_energia(void) {
+#if TEMPCYCLE_WIFI
+    if (cfg_energia.clock_sono_khz) return false;   // O SPI do cyw43 deriva do clk_sys
+#endif
+    energia_configurar(&cfg_energia);
+    return true;
+}
+
+#if TEMPCYCLE_WIFI
+static bool aplicar_rede(void) {
+    rede_configurar(&cfg_rede);
+    return true;
+}
+#endif
+
+static bool aplicar_brilho(void) {
+    npDefinirBrilho(brilho_np);
+    return true;
+}
+
+// Ajustáveis pelo console (set/get) e gravados na flash com 'salvar'
+static const parametro_t parametros_setup[] = {
+    { "aq.taxa_hz",    PARAM_U32,  &cfg_aquisicao.taxa_amostragem_hz, 733, 500000, aplicar_aquisicao,
+      "taxa total do ADC" },
+    { "aq.bloco",      PARAM_U16,  &cfg_aquisicao.amostras_bloco, 2, TEMP_BLOCO_MAX, aplicar_aquisicao,
+      "amostras por bloco do ping-pong (potencia de 2)" },
+    { "aq.janela_us",  PARAM_U32,  &cfg_aquisicao.janela_us, 10000, 10000000, aplicar_aquisicao,
+      "duracao da janela de media (multiplo de T.aquisicao)" },
+    { "aq.canais",     PARAM_U8,   &cfg_aquisicao.mascara_canais, 1, ADC_MASCARA_VALIDA, aplicar_aquisicao,
+      "mascara de entradas do ADC (bit 4 = sensor, obrigatorio; bit 3 reservado ao cyw43)" },
+    { "aq.rajada_hz",  PARAM_U32,  &cfg_aquisicao.taxa_rajada_hz, 0, 500000, aplicar_aquisicao,
+      "0 = continua; senao taxa da rajada" },
+    { "aq.seq",        PARAM_BOOL, &cfg_aquisicao.sequenciada, 0, 1, aplicar_aquisicao,
+      "janela de N amostras fechada pelo DMA" },
+    { "tend.janela",   PARAM_U16,  &cfg_tendencia.janela, 2, TENDENCIA_JANELA_MAX, aplicar_tendencia,
+      "medias no ajuste da tendencia" },
+    { "tend.suav",     PARAM_U8,   &cfg_tendencia.suavizacao, 0, 8, aplicar_tendencia,
+      "EWMA da inclinacao, alfa = 1/2^n" },
+    { "tend.limiar",   PARAM_I32,  &cfg_tendencia.limiar_mC_min, 1, 100000, aplicar_tendencia,
+      "m°C/min para sair de ESTAVEL" },
+    { "tend.volta",    PARAM_I32,  &cfg_tendencia.limiar_volta_mC_min, 0, 100000, aplicar_tendencia,
+      "m°C/min para voltar a ESTAVEL" },
+    { "energia.sono",  PARAM_BOOL, &cfg_energia.dormir_no_ocioso, 0, 1, aplicar_energia,
+      "dorme no ocioso" },
+    { "energia.khz",   PARAM_U32,  &cfg_energia.clock_sono_khz, 0, 133000, aplicar_energia,
+      "clock durante o sono (0 = nao troca)" },
+#if TEMPCYCLE_WIFI
+    { "rede.intervalo", PARAM_U16, &cfg_rede.intervalo_ms, 100, 60000, aplicar_rede,
+      "ms entre lotes UDP" },
+    { "rede.porta",    PARAM_U16,  &cfg_rede.porta, 1, 65535, aplicar_rede,
+      "porta UDP de destino" },
+#endif
+    { "np.brilho",     PARAM_U8,   &brilho_np, 0, 255, aplicar_brilho,
+      "brilho global da matriz" },
+    { "cor.estavel",   PARAM_U32,  &cores_tendencia[TENDENCIA_ESTÁVEL], 0, 0xFFFFFF, NULL,
+      "0xRRGGBB da matriz em ESTAVEL" },
+    { "cor.subindo",   PARAM_U32,  &cores_tendencia[TENDENCIA_SUBINDO], 0, 0xFFFFFF, NULL,
+      "0xRRGGBB da matriz em SUBINDO" },
+    { "cor.caindo",    PARAM_U32,  &cores_tendencia[TENDENCIA_CAINDO], 0, 0xFFFFFF, NULL,
+      "0xRRGGBB da matriz em CAINDO" },
+};
+
+// === etapas do boot (ordem = ordem de execução; ver boot.h) ===
+
+static void etapa_usb(void) {
+    // Inicializa a comunicação usb para printf() (a enumeração segue em segundo plano)
     stdio_init_all();
-    // While (!stdio_usb_connected()) sleep_ms(200); aguarda conexão usb
+    supervisor_iniciar();  // Guarda a causa do reset anterior antes de religar o watchdog
+}
+
+static void etapa_parametros(void) {
+    // Valores salvos pelo console substituem os padrões antes de qualquer configurar
+    parametros_carregar();
+    parametros_registrar(parametros_setup, count_of(parametros_setup));
+}
 
+static void etapa_aquisicao(void) {
     // Inicializa o adc do rp2040 e habilita o sensor interno (canal 4)
     adc_init();
     adc_set_temp_sensor_enabled(true);
+    tarefa1_configurar(&cfg_aquisicao);  // Divisor do adc e tamanho de bloco
 
-    // Configura o canal dma 0 para transferir dados do adc
+    // Configuração base dos canais dma do adc (o encadeamento A↔B
+    // é definido em tarefa1_temp.c ao iniciar a aquisição)
     cfg_temp = dma_channel_get_default_config(DMA_TEMP_CHANNEL);
     channel_config_set_transfer_data_size(&cfg_temp, DMA_SIZE_16);  // 16 bits
     channel_config_set_read_increment(&cfg_temp, false);            // Adc fifo fixo
     channel_config_set_write_increment(&cfg_temp, true);            // Buffer se move
     channel_config_set_dreq(&cfg_temp, DREQ_ADC);                   // Dispara com adc
 
-    // Configura interrupção do canal dma 0
-    dma_channel_set_irq0_enabled(DMA_TEMP_CHANNEL, true);
-    irq_set_exclusive_handler(DMA_IRQ_0, dma_handler_temp);
-    irq_set_enabled(DMA_IRQ_0, true);
+    // Liga a aquisição: irq do dma e ping-pong no núcleo 0, ou no
+    // núcleo 1 quando compilado com TEMPCYCLE_DUAL_CORE
+    aquisicao_iniciar();
+}
 
+static void etapa_tendencia(void) {
+    sincronizar_periodo_tendencia();
+    tarefa3_configurar(&cfg_tendencia);  // Janela e limiares da tendência
+}
+
+static void etapa_oled(void) {
     // Inicializa o display oled ssd1306 via i2c
-    i2c_init(i2c1, 400 * 1000);  // <---i2c primeiro
+    i2c_init(i2c1, OLED_I2C_HZ);  // <---i2c primeiro
     gpio_set_function(14, GPIO_FUNC_I2C);
     gpio_set_function(15, GPIO_FUNC_I2C);
     gpio_pull_up(14);
     gpio_pull_up(15);
+    barramento_i2c_iniciar(i2c1);  // Árbitro do i2c1: OLED e sensores externos
 
-    ssd1306_init();             // <---depois do i2c estar pronto
+    ssd1306_init();             // <---depois do i2c estar pronto (não espera o barramento)
     calculate_render_area_buffer_length(&area);
+    grafico_iniciar(ssd);       // Páginas 1–3: gráfico das médias
+}
 
+static void etapa_neopixel(void) {
     // Inicializa neopixel (matriz rgb)
     npInit(LED_PIN);  // Substitua led_pin pelo valor real, ex: 7
-}
\ No newline at end of file
+    npDefinirBrilho(brilho_np);
+}
+
+static void etapa_historico(void) {
+    historico_iniciar();                 // Acha o setor mais recente do histórico
+}
+
+static void etapa_energia(void) {
+    // Sono no ocioso e clock do sono (depois do i2c e do pio, que ele reajusta)
+#if TEMPCYCLE_WIFI
+    cfg_energia.clock_sono_khz = 0;   // Valor salvo de um build sem rádio
+#endif
+    energia_configurar(&cfg_energia);
+}
+
+#if TEMPCYCLE_WIFI
+static void etapa_rede(void) {
+    // Telemetria por UDP: conecta em segundo plano, sem esperar o enlace
+    rede_iniciar(&cfg_rede);
+}
+#endif
+
+// A aquisição vem logo depois dos parâmetros: o resto inicia com o ADC já amostrando
+static const etapa_boot_t etapas_setup[] = {
+    { "memoria",    memoria_pintar_pilhas },   // Antes de qualquer IRQ e do núcleo 1
+    { "usb",        etapa_usb },
+    { "parametros", etapa_parametros },
+    { "aquisicao",  etapa_aquisicao },
+    { "tendencia",  etapa_tendencia },
+    { "oled",       etapa_oled },
+    { "neopixel",   etapa_neopixel },
+    { "historico",  etapa_historico },
+    { "energia",    etapa_energia },
+#if TEMPCYCLE_WIFI
+    { "rede",       etapa_rede },
+#endif
+};
+
+/**
+ * @brief Realiza a configuração inicial do sistema.
+ *
+ * Roda as etapas do boot uma única vez (chamadas seguintes não fazem
+ * nada): pintura das pilhas, USB, parâmetros, ADC e DMA, tendência,
+ * OLED, matriz, histórico, energia e rede.
+ */
+void setup() {
+    boot_executar(etapas_setup, count_of(etapas_setup));
+}
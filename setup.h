@@ -1,12 +1,35 @@
 #ifndef SETUP_H
 #define SETUP_H
 
+#include <stdbool.h>
+#include <stdint.h>
 #include "hardware/dma.h"
+#include "tarefa1_temp.h"
+#include "tarefa3_tendencia.h"
+#include "energia.h"
+#include "telemetria_rede.h"
 
 #define DMA_TEMP_CHANNEL 0
+#define DMA_TEMP_CHANNEL_B 1   // Segunda metade do ping-pong
+#define OLED_I2C_HZ (400 * 1000)
 
 extern dma_channel_config cfg_temp;
+extern config_aquisicao_t cfg_aquisicao;
+extern config_tendencia_t cfg_tendencia;
+extern config_energia_t cfg_energia;
+extern config_rede_t cfg_rede;
 
 void setup(void);
 
+/**
+ * @brief Período da tarefa de aquisição: confere com a janela e ajusta o
+ *        período da tendência.
+ *
+ * A janela precisa ser múltiplo do período (cada janela lida uma vez).
+ *
+ * @param forcar Aplica mesmo sem caber (boot com valores salvos incoerentes).
+ * @return false se a janela não é múltiplo do período (sem 'forcar', nada muda).
+ */
+bool setup_periodo_aquisicao(uint32_t periodo_ms, bool forcar);
+
 #endif
@@ -0,0 +1,169 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: supervisor.c
+ *  Projeto: TempCycleDMA
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Implementação do supervisor de batidas.
+ *
+ *      Cada fonte escreve só o próprio 'ultima_ms' (uma
+ *      palavra alinhada, atômica entre núcleos); apenas o
+ *      núcleo 0 registra e verifica.
+ *
+ *      Scratch do watchdog:
+ *          [0] SUPERVISOR_MAGICA
+ *          [1] fonte em execução
+ *          [2] fonte que faltou (bits 0–7, NENHUMA até haver
+ *              falta) e instante da falta em ms (bits 8–31)
+ *          [3] atraso da falta (ms)
+ *          [4..7] reservados ao SDK
+ *
+ *  Relacionamento:
+ *      - Batidas das tarefas dadas por 'executor.c'
+ *      - Batida do núcleo 1 em 'aquisicao.c'
+ *      - Verificação no ocioso de 'main.c'
+ *
+ *
+ *  Data: 14/10/2026
+ * ------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "hardware/watchdog.h"
+#include "supervisor.h"
+
+#define SUPERVISOR_MAGICA 0x53555056u   // "SUPV"
+
+typedef struct {
+    const char *nome;
+    uint32_t prazo_ms;
+    volatile uint32_t ultima_ms;
+    uint32_t faltas;
+} fonte_t;
+
+static fonte_t fontes[SUPERVISOR_MAX_FONTES];
+static uint8_t n_fontes = 0;
+static bool ativo = false;
+static bool falta_registrada = false;
+static bool causa_lida = false;
+static causa_reset_t causa = { false, SUPERVISOR_NENHUMA, SUPERVISOR_NENHUMA, 0, 0 };
+static uint32_t alimentacoes = 0;
+
+static inline uint32_t agora_ms(void) {
+    return to_ms_since_boot(get_absolute_time());
+}
+
+void supervisor_iniciar(void) {
+    if (causa_lida) return;
+    causa_lida = true;
+
+    causa.por_watchdog = watchdog_enable_caused_reboot();
+    if (watchdog_hw->scratch[0] == SUPERVISOR_MAGICA) {
+        causa.em_execucao = (uint8_t)watchdog_hw->scratch[1];
+        causa.faltou = (uint8_t)(watchdog_hw->scratch[2] & 0xFFu);
+        causa.atraso_ms = watchdog_hw->scratch[3];
+        causa.ativo_ms = watchdog_hw->scratch[2] >> 8;
+    }
+
+    watchdog_hw->scratch[0] = SUPERVISOR_MAGICA;
+    watchdog_hw->scratch[1] = SUPERVISOR_NENHUMA;
+    watchdog_hw->scratch[2] = SUPERVISOR_NENHUMA;
+    watchdog_hw->scratch[3] = 0;
+}
+
+uint8_t supervisor_registrar(const char *nome, uint32_t prazo_ms) {
+    uint8_t id;
+    for (id = 0; id < n_fontes; id++) {
+        if (strcmp(fontes[id].nome, nome) == 0) break;
+    }
+    if (id == n_fontes) {
+        if (n_fontes == SUPERVISOR_MAX_FONTES) return SUPERVISOR_NENHUMA;
+        n_fontes++;
+        fontes[id].faltas = 0;
+    }
+
+    fontes[id].nome = nome;
+    fontes[id].prazo_ms = prazo_ms;
+    fontes[id].ultima_ms = agora_ms();
+    return id;
+}
+
+void supervisor_batida(uint8_t id) {
+    if (id < SUPERVISOR_MAX_FONTES) fontes[id].ultima_ms = agora_ms();
+}
+
+void supervisor_marcar(uint8_t id) {
+    watchdog_hw->scratch[1] = id;
+}
+
+void supervisor_ativar(void) {
+    if (ativo) return;
+    ativo = true;
+    watchdog_enable(SUPERVISOR_WATCHDOG_MS, true);
+}
+
+bool supervisor_verificar(void) {
+    uint32_t agora = agora_ms();
+
+    for (uint8_t i = 0; i < n_fontes; i++) {
+        uint32_t atraso = agora - fontes[i].ultima_ms;
+        if (atraso <= fontes[i].prazo_ms) continue;
+
+        // Só a primeira falta do episódio vai para os scratch: é ela que explica o reset
+        if (!falta_registrada) {
+            falta_registrada = true;
+            fontes[i].faltas++;
+            watchdog_hw->scratch[2] = (agora << 8) | i;
+            watchdog_hw->scratch[3] = atraso;
+        }
+        return false;
+    }
+
+    // Todas em dia de novo (quadro longo, mas legítimo): a falta não explica mais nada
+    if (falta_registrada) {
+        falta_registrada = false;
+        watchdog_hw->scratch[2] = SUPERVISOR_NENHUMA;
+        watchdog_hw->scratch[3] = 0;
+    }
+
+    if (ativo) {
+        watchdog_update();
+        alimentacoes++;
+    }
+    return true;
+}
+
+const causa_reset_t *supervisor_causa_anterior(void) {
+    return &causa;
+}
+
+static const char *nome_fonte(uint8_t id) {
+    if (id == SUPERVISOR_OCIOSO) return "ocioso";
+    if (id == SUPERVISOR_NENHUMA) return "-";
+    return id < n_fontes ? fontes[id].nome : "?";
+}
+
+void supervisor_relatorio(void) {
+    if (causa.por_watchdog) {
+        printf("Supervisor: reset pelo watchdog | rodando: %s | faltou: %s",
+               nome_fonte(causa.em_execucao), nome_fonte(causa.faltou));
+        if (causa.faltou != SUPERVISOR_NENHUMA) {
+            printf(" (%lu ms sem batida, aos %lu ms)",
+                   (unsigned long)causa.atraso_ms, (unsigned long)causa.ativo_ms);
+        }
+        printf("\n");
+    } else {
+        printf("Supervisor: boot normal\n");
+    }
+
+    uint32_t agora = agora_ms();
+    printf("  watchdog %s (%u ms), alimentado %lu vezes\n", ativo ? "ligado" : "desligado",
+           SUPERVISOR_WATCHDOG_MS, (unsigned long)alimentacoes);
+    for (uint8_t i = 0; i < n_fontes; i++) {
+        printf("  %-10s prazo %5lu ms | ultima batida ha %5lu ms | faltas %lu\n",
+               fontes[i].nome, (unsigned long)fontes[i].prazo_ms,
+               (unsigned long)(agora - fontes[i].ultima_ms), (unsigned long)fontes[i].faltas);
+    }
+}
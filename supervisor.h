@@ -0,0 +1,92 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: supervisor.h
+ *  Projeto: TempCycleDMA
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Supervisor de saúde das tarefas sobre o watchdog.
+ *
+ *      Cada fonte (tarefa do executor, laço do núcleo 1)
+ *      registra um prazo e dá batidas ao terminar cada ciclo.
+ *      O watchdog só é alimentado quando todas as fontes
+ *      bateram dentro do prazo; uma fonte atrasada (ou uma
+ *      tarefa travada, que impede o próprio laço) para a
+ *      alimentação e o chip reinicia.
+ *
+ *      Os registradores scratch 0–3 do watchdog (livres para
+ *      a aplicação; 4–7 são do SDK) guardam o que rodava e a
+ *      fonte que faltou, para o boot seguinte relatar a causa.
+ *
+ *
+ *  Data: 14/10/2026
+ * ------------------------------------------------------------
+ */
+
+#ifndef SUPERVISOR_H
+#define SUPERVISOR_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SUPERVISOR_MAX_FONTES 10
+// Maior quadro legítimo que ainda não reinicia (apagar a flash leva até ~400 ms)
+#define SUPERVISOR_WATCHDOG_MS 2000u
+
+#define SUPERVISOR_NENHUMA 0xFFu   // Nenhuma fonte (id inválido)
+#define SUPERVISOR_OCIOSO  0xFEu   // Laço ocioso do executor, fora das tarefas
+
+// O que os scratch contavam no boot
+typedef struct {
+    bool     por_watchdog;    // Reset causado pelo watchdog habilitado
+    uint8_t  em_execucao;     // Fonte rodando no momento (id, OCIOSO ou NENHUMA)
+    uint8_t  faltou;          // Primeira fonte vista fora do prazo (ou NENHUMA)
+    uint32_t atraso_ms;       // Tempo desde a última batida dela
+    uint32_t ativo_ms;        // Tempo de boot quando a falta foi vista
+} causa_reset_t;
+
+/**
+ * @brief Lê e limpa os scratch do boot anterior (só na primeira chamada).
+ */
+void supervisor_iniciar(void);
+
+/**
+ * @brief Registra uma fonte de batidas; o mesmo nome devolve o mesmo id.
+ *
+ * O registro conta como a primeira batida. Registre antes de a fonte
+ * começar a bater (o núcleo 1 é registrado pelo núcleo 0).
+ *
+ * @param prazo_ms Maior intervalo aceitável entre batidas
+ * @return id da fonte, ou SUPERVISOR_NENHUMA se a tabela estiver cheia
+ */
+uint8_t supervisor_registrar(const char *nome, uint32_t prazo_ms);
+
+/**
+ * @brief Registra uma batida da fonte (qualquer núcleo, custo constante).
+ */
+void supervisor_batida(uint8_t id);
+
+/**
+ * @brief Anota nos scratch o que está rodando agora.
+ */
+void supervisor_marcar(uint8_t id);
+
+/**
+ * @brief Liga o watchdog com SUPERVISOR_WATCHDOG_MS.
+ */
+void supervisor_ativar(void);
+
+/**
+ * @brief Confere os prazos e alimenta o watchdog se todas as fontes bateram.
+ *
+ * @return false se alguma fonte está atrasada (o watchdog não foi alimentado)
+ */
+bool supervisor_verificar(void);
+
+const causa_reset_t *supervisor_causa_anterior(void);
+
+/**
+ * @brief Imprime a causa do último reset e a idade da batida de cada fonte.
+ */
+void supervisor_relatorio(void);
+
+#endif  // SUPERVISOR_H
@@ -5,28 +5,77 @@
  * ------------------------------------------------------------
  *  Descrição:
  *      Este módulo implementa a Tarefa 1 do executor cíclico,
- *      responsável por realizar a leitura do sensor interno
- *      de temperatura utilizando ADC + DMA, durante um intervalo
- *      contínuo de 0,5 segundos.
+ *      o motor de aquisição do ADC: lê o sensor interno de
+ *      temperatura e, opcionalmente, as entradas analógicas
+ *      externas (GPIO26–28) usando ADC + DMA, em janelas
+ *      contínuas de 0,5 segundos.
  *
- *      A leitura é feita em blocos menores (10.000 amostras)
- *      para evitar o uso excessivo da SRAM do RP2040. Cada
- *      bloco é transferido via DMA e processado de forma
- *      incremental para obter a média da temperatura ao final
- *      do intervalo total.
+ *      A taxa de amostragem do ADC, o tamanho de cada bloco, a
+ *      duração da janela e os canais lidos vêm de
+ *      'config_aquisicao_t' (definida em 'setup.c'), em vez de o
+ *      ADC rodar livre a ~500 ksps.
+ *
+ *      Com mais de um canal o ADC opera em round-robin
+ *      ('adc_set_round_robin'), intercalando as conversões no
+ *      mesmo FIFO. Um único par de canais DMA atende todos os
+ *      canais analógicos.
+ *
+ *      A leitura é contínua: dois canais DMA encadeados
+ *      (ping-pong) gravam alternadamente nas duas metades de
+ *      'buffer_temp'. Cada canal tem um anel de escrita
+ *      ('channel_config_set_ring') do tamanho da sua metade, de
+ *      modo que o endereço volta ao início sozinho e nenhum
+ *      rearme é necessário. A metade concluída é separada por
+ *      canal e reduzida no handler de IRQ enquanto a outra
+ *      enche. O ADC nunca é parado entre blocos e a CPU nunca
+ *      espera pelo DMA.
+ *
+ *      Com 'taxa_rajada_hz' ≠ 0 (modo de economia) as mesmas
+ *      amostras de cada janela são lidas em rajada: o ADC roda
+ *      na taxa da rajada só até completar os blocos da janela,
+ *      e então a IRQ o para e desliga junto com o sensor. O
+ *      fechamento da janela religa os dois e dispara a rajada
+ *      seguinte; o DMA fica armado no mesmo ponto do anel.
+ *
+ *      Com 'sequenciada' (padrão) a janela deixa de ser fechada
+ *      pelo relógio da tarefa: ela tem exatamente N = taxa ×
+ *      janela amostras, cadenciadas pelo divisor do ADC. O canal
+ *      A grava a janela inteira numa metade de 'buffer_temp' e,
+ *      ao terminar, dispara o canal B, que copia o endereço da
+ *      próxima metade de uma tabela de blocos de controle para
+ *      o WRITE_ADDR_TRIG do A (a contagem N é recarregada pelo
+ *      hardware). A CPU recebe uma IRQ por janela, e o instante
+ *      de cada janela sai da contagem de ciclos do clk_adc, não
+ *      do momento em que a tarefa a lê.
  *
  *  Funcionalidades:
- *      - Converte valores brutos do ADC para graus Celsius.
+ *      - Acumula as contagens brutas de 12 bits em inteiros
+ *        (32 bits por metade, 64 bits por janela), separadas
+ *        por canal, e converte uma única vez por janela, em
+ *        ponto fixo (m°C para o sensor, µV para as entradas).
+ *      - Calibração do sensor (Vref, tensão a 27 °C e
+ *        inclinação) ajustável em tempo de execução.
  *      - Controla o tempo de aquisição com precisão usando
- *        o clock interno via 'get_absolute_time()'.
- *      - Utiliza DMA canal 0 e depende da flag 'dma_temp_done'
- *        sinalizada pelo handler definido em 'irq_handlers.c'.
+ *        o clock interno via 'get_absolute_time()' ou, no modo
+ *        sequenciado, pela própria contagem de amostras.
+ *      - Utiliza os canais DMA 0 e 1 encadeados; o handler
+ *        definido em 'irq_handlers.c' chama
+ *        'tarefa1_bloco_concluido()' a cada metade preenchida.
+ *      - Conta blocos perdidos quando a redução de uma metade
+ *        não termina antes de o DMA voltar a escrevê-la.
+ *      - Registra mínimo e máximo brutos e o desvio padrão de
+ *        cada canal e o instante de fechamento de cada janela.
+ *      - Na mesma passada, acumula o histograma das contagens
+ *        do sensor (dois, alternados a cada janela, para a IRQ
+ *        nunca esperar a tarefa) de onde saem a mediana e a
+ *        média aparada.
  *
  *  Relacionamento:
- *      - Chamado pelo laço principal em 'main.c' como tarefa do ciclo.
+ *      - Acionado por 'aquisicao.c', no núcleo 0 (tarefa do ciclo)
+ *        ou no núcleo 1 (modo TEMPCYCLE_DUAL_CORE).
  *      - Requer configuração do canal DMA e IRQ em 'setup.c'.
  *
- *  
+ *
  *  Data: 11/05/2025
  * ------------------------------------------------------------
  */
@@ -36,104 +85,634 @@
 #include "hardware/dma.h"
 #include "hardware/sync.h"
 #include "tarefa1_temp.h"
+#include "reducao.h"
+#include "instrumentacao.h"
+#include "caminho_rapido.h"
+
+#define ADC_CLOCK_HZ 48000000u        // clk_adc vindo da PLL USB
+#define ADC_CICLOS_CONVERSAO 96u      // Ciclos de clk_adc por conversão
+#define ADC_TAXA_MIN_HZ (ADC_CLOCK_HZ / 65536u + 1u)  // Limite do divisor 16.8
+#define ADC_GPIO_BASE 26u             // Canal 0 → GPIO26
+#define ADC_ESTABILIZACAO_US 20u      // Sensor e referência após religar
 
-#define BLOCO_AMOSTRAS 10000
-#define DURACAO_AMOSTRAGEM_US 500000  // 0,5 segundos em microssegundos
+// Duas metades de até TEMP_BLOCO_MAX amostras cada (ou de uma janela
+// sequenciada, que ocupa o mesmo buffer). O alinhamento ao tamanho do
+// ping-pong garante que cada metade fique alinhada ao seu anel.
+static uint16_t buffer_temp[TEMP_BUFFER_AMOSTRAS]
+    __attribute__((aligned(2 * TEMP_BLOCO_MAX * sizeof(uint16_t))));
 
-static uint16_t buffer_temp[BLOCO_AMOSTRAS];
-extern volatile bool dma_temp_done;
+// Blocos de controle do modo sequenciado: destino de cada janela, lido em
+// anel pelo canal B. Alinhados ao tamanho da tabela (exigência do anel).
+static uint16_t *blocos_controle[2] __attribute__((aligned(2 * sizeof(uint16_t *))));
+
+// Configuração efetiva (já validada) da aquisição
+static config_aquisicao_t cfg_aq = CONFIG_AQUISICAO_PADRAO;
+
+// Canais DMA de cada metade: [0] escreve na primeira, [1] na segunda
+static int canais_dma[2];
+static dma_channel_config cfg_dma_base;
+
+// Modo sequenciado: amostras por janela (0 = janela por tempo) e
+// ciclos de clk_adc entre conversões, para datar as janelas
+static uint32_t amostras_janela = 0;
+static uint32_t ciclos_amostra = ADC_CICLOS_CONVERSAO;
+
+// Ordem em que o round-robin entrega as amostras no FIFO
+static uint8_t ordem_canais[ADC_NUM_CANAIS] DADOS_AQUISICAO;
+static uint8_t n_canais DADOS_AQUISICAO = 0;
+static uint8_t fase_rr DADOS_AQUISICAO = 0;   // Posição em 'ordem_canais' da próxima amostra
+
+// Calibração do sensor interno (valores típicos do datasheet do RP2040)
+static calib_temp_t calib = CALIB_TEMP_PADRAO;
+
+// Conversões das somas da janela para µV e m°C (ver reducao.c)
+static inline int64_t converter_soma_uV(uint64_t soma, uint32_t n) {
+    return reducao_media_uV(&calib, soma, n);
+}
+
+static inline int32_t converter_soma_mC(uint64_t soma, uint32_t n) {
+    return reducao_media_mC(&calib, soma, n);
+}
 
 /**
- * @brief Converte valor do ADC para temperatura em °C.
- * 
- * @param raw Valor bruto de 12 bits lido do ADC.
- * @return float Temperatura em graus Celsius.
+ * @brief Define a calibração usada na conversão para °C.
+ *
+ * A nova calibração vale a partir da próxima janela fechada.
+ *
+ * @param nova Parâmetros de calibração (inclinação deve ser > 0).
  */
-static float convert_to_celsius(uint16_t raw) {
-    const float conv = 3.3f / (1 << 12);  // Conversão para tensão
-    float voltage = raw * conv;
-    return 27.0f - (voltage - 0.706f) / 0.001721f;
+void tarefa1_definir_calibracao(const calib_temp_t *nova) {
+    if (nova && nova->inclinacao_uv_c > 0) {
+        calib = *nova;
+    }
 }
 
 /**
- * @brief Inicia uma transferência via DMA de um bloco do sensor de temperatura.
+ * @brief Calcula o divisor do ADC para a taxa pedida e o aplica.
  *
- * @param buffer Buffer de destino.
- * @param cfg Configuração do canal DMA.
- * @param dma_chan Canal DMA utilizado.
+ * O período entre conversões é (1 + div) ciclos de clk_adc; abaixo de
+ * 96 ciclos o ADC simplesmente roda na taxa máxima (~500 ksps).
+ *
+ * @param taxa_hz Taxa de amostragem desejada.
  */
-static void iniciar_dma_temp(uint16_t *buffer, dma_channel_config *cfg, int dma_chan) {
-    adc_select_input(4);           // Canal 4 → sensor interno
-    adc_fifo_drain();
-    adc_run(false);
-    adc_fifo_setup(true, true, 1, false, false);
-    adc_run(true);
+static void aplicar_taxa_adc(uint32_t taxa_hz) {
+    uint32_t ciclos = ADC_CLOCK_HZ / taxa_hz;
+    adc_set_clkdiv(ciclos > ADC_CICLOS_CONVERSAO ? (float)(ciclos - 1) : 0.0f);
+    ciclos_amostra = ciclos > ADC_CICLOS_CONVERSAO ? ciclos : ADC_CICLOS_CONVERSAO;
+}
+
+/**
+ * @brief Monta a ordem de entrega do round-robin a partir da máscara.
+ *
+ * O ADC percorre as entradas habilitadas em ordem crescente a partir da
+ * entrada selecionada, por isso a aquisição sempre parte da menor.
+ */
+static void montar_ordem_canais(uint8_t mascara) {
+    n_canais = 0;
+    for (uint8_t c = 0; c < ADC_NUM_CANAIS; c++) {
+        if (mascara & (1u << c)) {
+            ordem_canais[n_canais++] = c;
+        }
+    }
+}
+
+/**
+ * @brief Retorna log2 de um valor que já é potência de dois.
+ */
+static uint log2_pot2(uint32_t v) {
+    uint bits = 0;
+    while (v > 1u) {
+        v >>= 1;
+        bits++;
+    }
+    return bits;
+}
+
+/**
+ * @brief Arma o ping-pong: cada canal enche uma metade de um bloco.
+ *
+ * O canal B fica armado, aguardando o encadeamento vindo do A; o A
+ * parte imediatamente e espera o DREQ do ADC.
+ */
+static void armar_dma_ping_pong(uint16_t *buffer, dma_channel_config *cfg, int dma_chan, int dma_chan_b) {
+    const uint32_t n = cfg_aq.amostras_bloco;
+    uint bits_anel = log2_pot2(n * sizeof(uint16_t));
+
+    dma_channel_config cfg_a = *cfg;
+    dma_channel_config cfg_b = *cfg;
+    channel_config_set_ring(&cfg_a, true, bits_anel);
+    channel_config_set_ring(&cfg_b, true, bits_anel);
+    channel_config_set_chain_to(&cfg_a, dma_chan_b);
+    channel_config_set_chain_to(&cfg_b, dma_chan);
 
+    dma_channel_configure(
+        dma_chan_b,
+        &cfg_b,
+        buffer + n, &adc_hw->fifo,
+        n,
+        false
+    );
     dma_channel_configure(
         dma_chan,
-        cfg,
+        &cfg_a,
         buffer, &adc_hw->fifo,
-        BLOCO_AMOSTRAS,
+        n,
         true
     );
 }
 
 /**
- * @brief Executa a Tarefa 1 do executor cíclico: coleta de temperatura por 0,5s.
+ * @brief Arma a cadeia de blocos de controle do modo sequenciado.
  *
- * @param cfg_temp Configuração do canal DMA.
- * @param dma_chan Número do canal DMA utilizado.
- * @return float Temperatura média calculada ao final do intervalo.
+ * O canal A (dados) grava 'amostras_janela' amostras numa metade e
+ * encadeia o canal B (controle). O B lê o próximo destino da tabela
+ * 'blocos_controle' (anel de leitura de 8 bytes, sem DREQ) e o escreve
+ * no WRITE_ADDR_TRIG do A, que recarrega a contagem e volta a esperar o
+ * ADC. Só o A gera IRQ: o B roda quieto.
  */
+static void armar_dma_sequenciado(uint16_t *buffer, dma_channel_config *cfg, int dma_chan, int dma_chan_b) {
+    blocos_controle[0] = buffer;
+    blocos_controle[1] = buffer + amostras_janela;
+
+    dma_channel_config cfg_dados = *cfg;
+    channel_config_set_chain_to(&cfg_dados, dma_chan_b);
 
-typedef enum {
-    ESTADO_PARADO = 0,
-    ESTADO_INICIANDO,
-    ESTADO_AGUARDANDO_DMA
-} estado_tarefa1_t;
+    dma_channel_config cfg_ctrl = dma_channel_get_default_config(dma_chan_b);
+    channel_config_set_transfer_data_size(&cfg_ctrl, DMA_SIZE_32);
+    channel_config_set_read_increment(&cfg_ctrl, true);
+    channel_config_set_write_increment(&cfg_ctrl, false);
+    channel_config_set_ring(&cfg_ctrl, false, log2_pot2(sizeof(blocos_controle)));
+    channel_config_set_irq_quiet(&cfg_ctrl, true);
 
-static estado_tarefa1_t estado_t1 = ESTADO_PARADO;
+    // A primeira janela já vai para a metade 0; o controle começa pela 1
+    dma_channel_configure(
+        dma_chan_b,
+        &cfg_ctrl,
+        &dma_hw->ch[dma_chan].al2_write_addr_trig, &blocos_controle[1],
+        1,
+        false
+    );
+    dma_channel_configure(
+        dma_chan,
+        &cfg_dados,
+        buffer, &adc_hw->fifo,
+        amostras_janela,
+        true
+    );
+}
+
+/**
+ * @brief Inicia a aquisição contínua em ping-pong com dois canais DMA.
+ *
+ * Cada canal grava uma metade de 'buffer_temp' dentro do seu anel e, ao
+ * terminar, dispara o outro (chain_to). O canal B é apenas configurado;
+ * o canal A parte imediatamente junto com o ADC em modo free-running.
+ * No modo sequenciado o B é o canal de controle da cadeia de janelas.
+ *
+ * @param buffer Buffer de destino (duas metades consecutivas).
+ * @param cfg Configuração base do canal DMA.
+ * @param dma_chan Canal DMA da primeira metade.
+ * @param dma_chan_b Canal DMA da segunda metade.
+ */
+static void iniciar_dma_temp(uint16_t *buffer, dma_channel_config *cfg, int dma_chan, int dma_chan_b) {
+    montar_ordem_canais(cfg_aq.mascara_canais);
+    fase_rr = 0;
+
+    adc_run(false);
+    for (uint8_t i = 0; i < n_canais; i++) {
+        if (ordem_canais[i] < ADC_CANAL_TEMP) {
+            adc_gpio_init(ADC_GPIO_BASE + ordem_canais[i]);
+        }
+    }
+    adc_select_input(ordem_canais[0]);
+    adc_set_round_robin(n_canais > 1 ? cfg_aq.mascara_canais : 0);
+    adc_fifo_drain();
+    adc_fifo_setup(true, true, 1, false, false);
+
+    if (amostras_janela) {
+        armar_dma_sequenciado(buffer, cfg, dma_chan, dma_chan_b);
+    } else {
+        armar_dma_ping_pong(buffer, cfg, dma_chan, dma_chan_b);
+    }
+    adc_run(true);
+}
+
+/**
+ * @brief Para o ADC e os dois canais do ping-pong.
+ *
+ * O encadeamento é desfeito antes do abort para que abortar um canal
+ * não dispare o outro. Pela errata RP2040-E13, abortar um canal ativo
+ * levanta a flag de fim da transferência: as IRQs dos canais ficam
+ * desligadas durante o abort e a flag é limpa depois, senão o handler
+ * trataria uma metade parcial (e contaria um bloco da rajada).
+ * 'tarefa1_iniciar()' religa as IRQs.
+ */
+static void parar_dma_temp(void) {
+    adc_run(false);
+    for (int i = 0; i < 2; i++) {
+        dma_channel_set_irq0_enabled(canais_dma[i], false);
+        dma_channel_config c = cfg_dma_base;
+        channel_config_set_chain_to(&c, canais_dma[i]);
+        dma_channel_set_config(canais_dma[i], &c, false);
+    }
+    dma_channel_abort(canais_dma[0]);
+    dma_channel_abort(canais_dma[1]);
+    dma_hw->ints0 = (1u << canais_dma[0]) | (1u << canais_dma[1]);
+    adc_set_round_robin(0);
+    adc_fifo_drain();
+}
+
+static bool em_execucao = false;
 static absolute_time_t inicio_amostragem;
-static float soma_temp = 0.0f;
-static uint32_t total_amostras = 0;
-static float media_temp = 0.0f;
-
-bool tarefa1_obter_media_temp(dma_channel_config* cfg_temp, int dma_chan) {
-    switch (estado_t1) {
-        case ESTADO_PARADO:
-            soma_temp = 0.0f;
-            total_amostras = 0;
-            inicio_amostragem = get_absolute_time();
-            estado_t1 = ESTADO_INICIANDO;
-            break;
-
-        case ESTADO_INICIANDO:
-            dma_temp_done = false;
-            iniciar_dma_temp(buffer_temp, cfg_temp, dma_chan);
-            estado_t1 = ESTADO_AGUARDANDO_DMA;
-            break;
-
-        case ESTADO_AGUARDANDO_DMA:
-            if (dma_temp_done) {
-                adc_run(false);  // Desliga adc
-                for (int i = 0; i < BLOCO_AMOSTRAS; i++) {
-                    soma_temp += convert_to_celsius(buffer_temp[i]);
-                }
-                total_amostras += BLOCO_AMOSTRAS;
-
-                if (absolute_time_diff_us(inicio_amostragem, get_absolute_time()) >= DURACAO_AMOSTRAGEM_US) {
-                    media_temp = soma_temp / total_amostras;
-                    estado_t1 = ESTADO_PARADO;
-                    return true;  // Ciclo finalizado
-                } else {
-                    estado_t1 = ESTADO_INICIANDO;  // Novo bloco
-                }
-            }
-            break;
-    }
-    return false;  // Ciclo ainda em andament
-}
-
-float tarefa1_termina(){
-    return media_temp;
-}
\ No newline at end of file
+static uint64_t soma_bruta[ADC_NUM_CANAIS] DADOS_AQUISICAO;
+static uint64_t soma_q_bruta[ADC_NUM_CANAIS] DADOS_AQUISICAO;
+static uint32_t total_amostras[ADC_NUM_CANAIS] DADOS_AQUISICAO;
+static uint16_t min_bruto[ADC_NUM_CANAIS] DADOS_AQUISICAO;
+static uint16_t max_bruto[ADC_NUM_CANAIS] DADOS_AQUISICAO;
+static uint32_t blocos_perdidos = 0;
+static volatile uint32_t ultimo_bloco_us = 0;
+
+// Modo rajada: blocos que faltam na rajada corrente; 0 = ADC desligado
+static volatile uint32_t blocos_rajada_restantes = 0;
+static uint32_t blocos_por_rajada = 0;
+static uint64_t adc_ligado_acum_us = 0;
+static uint64_t adc_ligado_desde_us = 0;
+
+// Modo sequenciado: janela fechada pela IRQ, à espera da tarefa
+static volatile bool janela_pronta = false;
+static uint64_t janela_pronta_us;     // Instante da última amostra da janela
+static uint64_t inicio_seq_us;        // Partida do ADC (contínuo) ou da rajada
+static uint64_t ciclos_seq;           // Ciclos de clk_adc desde 'inicio_seq_us'
+static uint8_t metade_seq = 0;        // Metade que o canal de dados está enchendo
+
+// Histogramas do sensor: a IRQ enche o ativo, a tarefa lê o outro
+static reducao_hist_t hist_sensor[2];
+static uint8_t hist_ativo = 0;
+static uint8_t fase_sensor = ADC_NUM_CANAIS;   // Posição do sensor no round-robin
+
+// Contagem esperada para a temperatura dada (centro do histograma)
+static uint16_t contagem_para_mC(int32_t mC) {
+    int64_t uv = (int64_t)calib.v27_uv - (int64_t)(mC - 27000) * calib.inclinacao_uv_c / 1000;
+    if (uv < 0) uv = 0;
+    uint64_t c = (uint64_t)uv * 4096u / calib.vref_uv;
+    return c > 4095u ? 4095u : (uint16_t)c;
+}
+
+static uint32_t calcular_blocos_por_rajada(void) {
+    if (amostras_janela) return 1u;   // A janela sequenciada é um bloco só
+    uint64_t amostras = (uint64_t)cfg_aq.taxa_amostragem_hz * cfg_aq.janela_us / 1000000u;
+    uint32_t blocos = (uint32_t)((amostras + cfg_aq.amostras_bloco / 2) / cfg_aq.amostras_bloco);
+    return blocos ? blocos : 1u;
+}
+
+/**
+ * @brief Para o ADC e o desliga junto com o sensor (fim da rajada).
+ *
+ * Chamada com a IRQ do DMA em andamento (ou com IRQs desligadas).
+ */
+static void CAMINHO_RAPIDO(desligar_adc)(void) {
+    adc_run(false);
+    while (!(adc_hw->cs & ADC_CS_READY_BITS)) tight_loop_contents();
+    adc_set_temp_sensor_enabled(false);
+    hw_clear_bits(&adc_hw->cs, ADC_CS_EN_BITS);
+    adc_ligado_acum_us += time_us_64() - adc_ligado_desde_us;
+}
+
+static void ligar_adc(void) {
+    hw_set_bits(&adc_hw->cs, ADC_CS_EN_BITS);
+    while (!(adc_hw->cs & ADC_CS_READY_BITS)) tight_loop_contents();
+    adc_set_temp_sensor_enabled(true);
+    busy_wait_us_32(ADC_ESTABILIZACAO_US);
+}
+
+/**
+ * @brief Religa ADC e sensor e dispara a próxima rajada.
+ */
+static void iniciar_rajada(void) {
+    ligar_adc();
+    instr_irq_dma_retomar();
+    adc_ligado_desde_us = time_us_64();
+    inicio_seq_us = adc_ligado_desde_us;
+    ciclos_seq = 0;
+    blocos_rajada_restantes = blocos_por_rajada;
+    adc_run(true);
+}
+
+// Reduz 'n' amostras e soma os parciais nos acumuladores de cada canal
+static void CAMINHO_RAPIDO(acumular)(const uint16_t *inicio, uint32_t n) {
+    // TEMP_BLOCO_MAX × 4095 cabe com folga em 32 bits
+    reducao_bloco_t r;
+    fase_rr = reducao_bloco_hist(inicio, n, n_canais, fase_rr, &hist_sensor[hist_ativo], fase_sensor, &r);
+
+    for (uint8_t i = 0; i < n_canais; i++) {
+        uint8_t c = ordem_canais[i];
+        soma_bruta[c] += r.soma[i];
+        soma_q_bruta[c] += r.soma_q[i];
+        total_amostras[c] += r.cont[i];
+        if (r.vmin[i] < min_bruto[c]) min_bruto[c] = r.vmin[i];
+        if (r.vmax[i] > max_bruto[c]) max_bruto[c] = r.vmax[i];
+    }
+}
+
+static void CAMINHO_RAPIDO(zerar_acumuladores)(void) {
+    for (int c = 0; c < ADC_NUM_CANAIS; c++) {
+        soma_bruta[c] = 0;
+        soma_q_bruta[c] = 0;
+        total_amostras[c] = 0;
+        min_bruto[c] = 0xFFFF;
+        max_bruto[c] = 0;
+    }
+}
+
+/**
+ * @brief Fecha uma janela sequenciada (contexto de IRQ).
+ *
+ * O canal de controle já apontou o de dados para a outra metade, que
+ * tem uma janela inteira de folga; a concluída é reduzida em blocos de
+ * até TEMP_BLOCO_MAX e fica à espera da tarefa. Uma janela ainda não
+ * lida é descartada: as médias nunca juntam duas janelas.
+ */
+static void CAMINHO_RAPIDO(janela_sequenciada_concluida)(void) {
+    const uint16_t *inicio = buffer_temp + metade_seq * amostras_janela;
+    metade_seq ^= 1u;
+
+    if (janela_pronta) {
+        reducao_hist_t *h = &hist_sensor[hist_ativo];
+        blocos_perdidos++;
+        zerar_acumuladores();
+        reducao_hist_iniciar(h, h->base + REDUCAO_HIST_BINS / 2);
+    }
+    for (uint32_t feito = 0; feito < amostras_janela; feito += TEMP_BLOCO_MAX) {
+        uint32_t n = amostras_janela - feito;
+        acumular(inicio + feito, n < TEMP_BLOCO_MAX ? n : TEMP_BLOCO_MAX);
+    }
+
+    ciclos_seq += (uint64_t)amostras_janela * ciclos_amostra;
+    janela_pronta_us = inicio_seq_us + ciclos_seq / (ADC_CLOCK_HZ / 1000000u);
+    janela_pronta = true;
+}
+
+/**
+ * @brief Trata o fim de uma metade do ping-pong (contexto de IRQ).
+ *
+ * O anel de escrita já devolveu o canal ao início da sua metade e a
+ * contagem é recarregada pelo hardware; aqui a metade concluída é
+ * separada por canal e reduzida enquanto o outro canal DMA continua
+ * enchendo a metade oposta.
+ *
+ * No modo sequenciado só o canal de dados gera IRQ, uma por janela, e
+ * a metade é acompanhada em janela_sequenciada_concluida().
+ *
+ * @param metade Índice da metade concluída (0 ou 1; ignorado no modo sequenciado).
+ */
+void CAMINHO_RAPIDO(tarefa1_bloco_concluido)(int metade) {
+    ultimo_bloco_us = time_us_32();
+
+    if (amostras_janela) {
+        janela_sequenciada_concluida();
+    } else {
+        const uint32_t n = cfg_aq.amostras_bloco;
+        acumular(buffer_temp + metade * n, n);
+
+        // Se o canal desta metade já voltou a rodar, a outra metade terminou
+        // durante a redução e estes dados podem ter sido sobrescritos
+        if (dma_channel_is_busy(canais_dma[metade])) {
+            blocos_perdidos++;
+        }
+    }
+
+    if (blocos_por_rajada && blocos_rajada_restantes && --blocos_rajada_restantes == 0) {
+        desligar_adc();
+    }
+}
+
+/**
+ * @brief Liga o motor de aquisição (uma única vez).
+ *
+ * Chamadas seguintes com o motor já rodando não têm efeito.
+ *
+ * @param cfg Configuração base dos canais DMA.
+ * @param dma_chan Canal DMA da primeira metade.
+ * @param dma_chan_b Canal DMA da segunda metade.
+ */
+void tarefa1_iniciar(dma_channel_config *cfg, int dma_chan, int dma_chan_b) {
+    if (em_execucao) return;
+
+    cfg_dma_base = *cfg;
+    canais_dma[0] = dma_chan;
+    canais_dma[1] = dma_chan_b;
+
+    zerar_acumuladores();
+    montar_ordem_canais(cfg_aq.mascara_canais);
+    fase_sensor = ADC_NUM_CANAIS;
+    for (uint8_t i = 0; i < n_canais; i++) {
+        if (ordem_canais[i] == ADC_CANAL_TEMP) fase_sensor = i;
+    }
+    reducao_hist_iniciar(&hist_sensor[0], contagem_para_mC(27000));
+    reducao_hist_iniciar(&hist_sensor[1], contagem_para_mC(27000));
+    hist_ativo = 0;
+    inicio_amostragem = get_absolute_time();
+    blocos_por_rajada = cfg_aq.taxa_rajada_hz ? calcular_blocos_por_rajada() : 0;
+    blocos_rajada_restantes = blocos_por_rajada;
+    janela_pronta = false;
+    metade_seq = 0;
+    ciclos_seq = 0;
+    adc_ligado_desde_us = time_us_64();
+    inicio_seq_us = adc_ligado_desde_us;
+    // Desligadas por parar_dma_temp() num reinício
+    dma_channel_set_irq0_enabled(dma_chan, true);
+    dma_channel_set_irq0_enabled(dma_chan_b, true);
+    iniciar_dma_temp(buffer_temp, &cfg_dma_base, dma_chan, dma_chan_b);
+    em_execucao = true;
+}
+
+/**
+ * @brief Executa a Tarefa 1 do executor cíclico: fecha janelas de 0,5s.
+ *
+ * Quando 'janela_us' da configuração tiver passado (ou, no modo
+ * sequenciado, quando a IRQ tiver fechado as N amostras), copia e zera
+ * os acumuladores de todos os canais de forma atômica e converte cada
+ * média uma única vez.
+ *
+ * @param res Resultado da janela (preenchido apenas quando retorna true).
+ * @return true quando uma janela foi concluída.
+ */
+bool tarefa1_janela_concluida(resultado_aquisicao_t *res) {
+    if (!em_execucao) return false;
+
+    absolute_time_t agora = get_absolute_time();
+    if (amostras_janela ? !janela_pronta
+                        : absolute_time_diff_us(inicio_amostragem, agora) < cfg_aq.janela_us) {
+        return false;  // Janela ainda em andamento
+    }
+
+    // Fecha a janela sem parar o ADC; o handler só soma com IRQ ativa
+    uint64_t soma[ADC_NUM_CANAIS];
+    uint64_t soma_q[ADC_NUM_CANAIS];
+    uint32_t total[ADC_NUM_CANAIS];
+    uint32_t irq = save_and_disable_interrupts();
+    for (int c = 0; c < ADC_NUM_CANAIS; c++) {
+        soma[c] = soma_bruta[c];
+        soma_q[c] = soma_q_bruta[c];
+        total[c] = total_amostras[c];
+        res->min_bruto[c] = min_bruto[c];
+        res->max_bruto[c] = max_bruto[c];
+        soma_bruta[c] = 0;
+        soma_q_bruta[c] = 0;
+        total_amostras[c] = 0;
+        min_bruto[c] = 0xFFFF;
+        max_bruto[c] = 0;
+    }
+    uint64_t fechamento_us = amostras_janela ? janela_pronta_us : to_us_since_boot(agora);
+    janela_pronta = false;
+    reducao_hist_t *hist = &hist_sensor[hist_ativo];
+    hist_ativo ^= 1u;
+    restore_interrupts(irq);
+    inicio_amostragem = agora;
+
+    // Rajada concluída: as amostras da próxima janela são lidas agora
+    if (blocos_por_rajada && blocos_rajada_restantes == 0) {
+        iniciar_rajada();
+    }
+
+    res->timestamp_us = fechamento_us;
+    res->mascara = 0;
+    res->temp_mC = 0;
+    res->temp_min_mC = 0;
+    res->temp_max_mC = 0;
+    res->temp_mediana_mC = 0;
+    res->temp_aparada_mC = 0;
+    res->temp_desvio_mC = 0;
+    res->robusta_exata = false;
+    for (int c = 0; c < ADC_NUM_CANAIS; c++) {
+        res->amostras[c] = total[c];
+        res->media_uV[c] = 0;
+        res->desvio_uV[c] = 0;
+        if (total[c] == 0) continue;
+
+        res->mascara |= 1u << c;
+        res->media_uV[c] = (uint32_t)converter_soma_uV(soma[c], total[c]);
+        res->desvio_uV[c] = reducao_desvio_uV(&calib, soma[c], soma_q[c], total[c]);
+        if (c == ADC_CANAL_TEMP) {
+            // O sensor tem inclinação negativa: a maior contagem é a menor temperatura
+            res->temp_mC = converter_soma_mC(soma[c], total[c]);
+            res->temp_min_mC = converter_soma_mC(res->max_bruto[c], 1);
+            res->temp_max_mC = converter_soma_mC(res->min_bruto[c], 1);
+            res->temp_desvio_mC = reducao_desvio_mC(&calib, soma[c], soma_q[c], total[c]);
+        }
+    }
+
+    // O histograma lido volta a ser ativo na próxima janela, centrado na
+    // mediana desta (ou na média, se a mediana caiu fora da faixa)
+    reducao_robusta_t rb;
+    if (reducao_robusta(hist, &rb)) {
+        res->temp_mediana_mC = converter_soma_mC(rb.mediana, 1);
+        res->temp_aparada_mC = converter_soma_mC(rb.soma_aparada, rb.n_aparada);
+        res->robusta_exata = rb.na_faixa;
+    }
+    reducao_hist_iniciar(hist, res->robusta_exata ? rb.mediana : contagem_para_mC(res->temp_mC));
+    return res->mascara != 0;
+}
+
+/**
+ * @brief Aplica uma nova configuração de aquisição.
+ *
+ * Os valores são limitados ao que o hardware e o buffer estático
+ * suportam; o bloco é arredondado para baixo até uma potência de dois
+ * (exigência do anel do DMA). No modo sequenciado a janela vira um
+ * número de amostras; uma janela maior que TEMP_JANELA_SEQ_MAX desliga
+ * o modo. Se a aquisição já estiver rodando, ela é reiniciada com a
+ * nova configuração.
+ *
+ * @param cfg Taxa, tamanho de bloco, janela e canais do ADC.
+ */
+void tarefa1_configurar(const config_aquisicao_t *cfg) {
+    config_aquisicao_t nova = *cfg;
+
+    if (nova.taxa_amostragem_hz < ADC_TAXA_MIN_HZ) nova.taxa_amostragem_hz = ADC_TAXA_MIN_HZ;
+    if (nova.taxa_amostragem_hz > ADC_CLOCK_HZ / ADC_CICLOS_CONVERSAO)
+        nova.taxa_amostragem_hz = ADC_CLOCK_HZ / ADC_CICLOS_CONVERSAO;
+    if (nova.amostras_bloco < 2) nova.amostras_bloco = 2;
+    if (nova.amostras_bloco > TEMP_BLOCO_MAX) nova.amostras_bloco = TEMP_BLOCO_MAX;
+    nova.amostras_bloco = 1u << log2_pot2(nova.amostras_bloco);
+    nova.mascara_canais &= ADC_MASCARA_VALIDA;
+    nova.mascara_canais |= 1u << ADC_CANAL_TEMP;   // A temperatura da janela vem sempre do sensor
+    if (nova.taxa_rajada_hz) {
+        // Mais lenta que a nominal a rajada não caberia na janela
+        if (nova.taxa_rajada_hz < nova.taxa_amostragem_hz) nova.taxa_rajada_hz = nova.taxa_amostragem_hz;
+        if (nova.taxa_rajada_hz > ADC_CLOCK_HZ / ADC_CICLOS_CONVERSAO)
+            nova.taxa_rajada_hz = ADC_CLOCK_HZ / ADC_CICLOS_CONVERSAO;
+    }
+
+    // Janela sequenciada: múltiplo do round-robin, para cada canal receber
+    // o mesmo número de amostras; se não couber no buffer, volta ao tempo
+    uint32_t n_janela = 0;
+    if (nova.sequenciada) {
+        uint32_t canais = (uint32_t)__builtin_popcount(nova.mascara_canais);
+        uint64_t amostras = ((uint64_t)nova.taxa_amostragem_hz * nova.janela_us + 500000u) / 1000000u;
+        amostras -= amostras % canais;
+        if (amostras >= canais && amostras <= TEMP_JANELA_SEQ_MAX) {
+            n_janela = (uint32_t)amostras;
+        } else {
+            nova.sequenciada = false;
+        }
+    }
+
+    bool reiniciar = em_execucao;
+    if (reiniciar) {
+        parar_dma_temp();
+        if (blocos_por_rajada && blocos_rajada_restantes == 0) {
+            ligar_adc();   // Desligado no fim da última rajada
+        } else {
+            adc_ligado_acum_us += time_us_64() - adc_ligado_desde_us;
+        }
+        em_execucao = false;
+    }
+
+    cfg_aq = nova;
+    amostras_janela = n_janela;
+    aplicar_taxa_adc(cfg_aq.taxa_rajada_hz ? cfg_aq.taxa_rajada_hz : cfg_aq.taxa_amostragem_hz);
+
+    if (reiniciar) {
+        tarefa1_iniciar(&cfg_dma_base, canais_dma[0], canais_dma[1]);
+    }
+}
+
+uint32_t CAMINHO_RAPIDO(tarefa1_periodo_bloco_us)(void) {
+    uint32_t taxa = cfg_aq.taxa_rajada_hz ? cfg_aq.taxa_rajada_hz : cfg_aq.taxa_amostragem_hz;
+    uint32_t n = amostras_janela ? amostras_janela : cfg_aq.amostras_bloco;
+    return (uint32_t)((uint64_t)n * 1000000u / taxa);
+}
+
+uint32_t tarefa1_amostras_janela(void) {
+    return amostras_janela;
+}
+
+/**
+ * @brief Tempo até a próxima IRQ de bloco, que não pode ser segurada
+ *        por mais que um bloco sem perder dados.
+ *
+ * Com o ADC desligado entre rajadas não há IRQ prevista: a próxima
+ * rajada só parte do fechamento da janela, em contexto de thread.
+ */
+uint32_t tarefa1_folga_us(void) {
+    if (blocos_por_rajada && blocos_rajada_restantes == 0) return UINT32_MAX;
+
+    uint32_t desde_bloco = time_us_32() - ultimo_bloco_us;
+    uint32_t periodo = tarefa1_periodo_bloco_us();
+    return desde_bloco < periodo ? periodo - desde_bloco : 0;
+}
+
+uint64_t tarefa1_adc_ligado_us(void) {
+    uint32_t irq = save_and_disable_interrupts();
+    uint64_t total = adc_ligado_acum_us;
+    if (em_execucao && !(blocos_por_rajada && blocos_rajada_restantes == 0)) {
+        total += time_us_64() - adc_ligado_desde_us;
+    }
+    restore_interrupts(irq);
+    return total;
+}
+
+uint32_t tarefa1_blocos_perdidos(void) {
+    return blocos_perdidos;
+}
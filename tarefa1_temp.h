@@ -3,7 +3,85 @@
 
 #include "hardware/dma.h"
 
-bool tarefa1_obter_media_temp(dma_channel_config* cfg, int dma_chan);
-float tarefa1_termina();
+#define ADC_NUM_CANAIS 5      // Posições do round-robin: entradas 0–3 e sensor interno
+#define ADC_CANAL_TEMP 4      // Sensor interno de temperatura
 
-#endif
\ No newline at end of file
+// Entradas permitidas: 0–2 (GPIO26–28) e o sensor. No pico_w o GPIO29
+// (entrada 3) é o clock do SPI do cyw43 e não pode virar entrada analógica.
+#define ADC_MASCARA_VALIDA 0x17u
+
+// Calibração do sensor interno de temperatura (inteiros, sem float)
+typedef struct {
+    uint32_t vref_uv;          // Tensão de referência do ADC (µV)
+    uint32_t v27_uv;           // Tensão do sensor a 27 °C (µV)
+    uint32_t inclinacao_uv_c;  // Inclinação do sensor (µV/°C)
+} calib_temp_t;
+
+#define CALIB_TEMP_PADRAO { 3300000u, 706000u, 1721u }
+
+// Maior bloco (amostras por metade do ping-pong) suportado pelo buffer
+#define TEMP_BLOCO_MAX 256
+
+// Maior janela sequenciada pelo DMA (amostras por metade do buffer)
+#define TEMP_JANELA_SEQ_MAX 1024
+
+// Amostras de 'buffer_temp': duas metades do maior dos dois modos
+#define TEMP_BUFFER_AMOSTRAS (2 * (TEMP_JANELA_SEQ_MAX > TEMP_BLOCO_MAX ? TEMP_JANELA_SEQ_MAX : TEMP_BLOCO_MAX))
+
+// Parâmetros da aquisição usados por setup() e pela Tarefa 1
+typedef struct {
+    uint32_t taxa_amostragem_hz;  // Taxa total do ADC (≈733 Hz a 500 kHz)
+    uint16_t amostras_bloco;      // Amostras por metade (potência de 2, ≤ TEMP_BLOCO_MAX)
+    uint32_t janela_us;           // Duração da janela de média
+    uint8_t  mascara_canais;      // Bit n → entrada n do ADC (bit 4 = sensor, sempre ligado; bit 3 ignorado)
+    uint32_t taxa_rajada_hz;      // 0 = contínua; senão lê a janela em rajada e desliga o ADC
+    bool     sequenciada;         // Janela de N amostras fechada pelo DMA (≤ TEMP_JANELA_SEQ_MAX)
+} config_aquisicao_t;
+
+#ifndef TEMPCYCLE_ECONOMIA
+#define TEMPCYCLE_ECONOMIA 0
+#endif
+
+// Em rajada, o número de amostras por janela continua sendo o da taxa nominal
+// (1024 sps × 0,5 s = 512); só o tempo com o ADC ligado encolhe (~16 ms a 32 ksps)
+#define AQUISICAO_RAJADA_ECONOMIA_HZ 32000u
+
+// 1024 sps só no sensor, blocos de 256 amostras (250 ms) e janela de 0,5 s,
+// sequenciada pelo DMA (512 amostras exatas por janela). Em round-robin a
+// taxa total é dividida entre os canais habilitados.
+#define CONFIG_AQUISICAO_PADRAO { 1024u, 256u, 500000u, 1u << ADC_CANAL_TEMP, \
+                                  TEMPCYCLE_ECONOMIA ? AQUISICAO_RAJADA_ECONOMIA_HZ : 0u, true }
+
+// Médias de uma janela fechada, por canal
+typedef struct {
+    uint8_t  mascara;                      // Canais com amostras nesta janela
+    uint32_t amostras[ADC_NUM_CANAIS];     // Amostras acumuladas por canal
+    uint32_t media_uV[ADC_NUM_CANAIS];     // Tensão média por canal (µV)
+    uint16_t min_bruto[ADC_NUM_CANAIS];    // Menor contagem bruta por canal
+    uint16_t max_bruto[ADC_NUM_CANAIS];    // Maior contagem bruta por canal
+    int32_t  temp_mC;                      // Temperatura do sensor interno (m°C)
+    int32_t  temp_min_mC;                  // Menor temperatura da janela (m°C)
+    int32_t  temp_max_mC;                  // Maior temperatura da janela (m°C)
+    uint32_t desvio_uV[ADC_NUM_CANAIS];    // Desvio padrão por canal (µV)
+    int32_t  temp_mediana_mC;              // Mediana do sensor (m°C; imune a picos isolados)
+    int32_t  temp_aparada_mC;              // Média sem 1/8 de cada ponta (m°C)
+    uint32_t temp_desvio_mC;               // Desvio padrão do sensor (m°C)
+    bool     robusta_exata;                // false: mediana fora da faixa do histograma (aproximada)
+    uint64_t timestamp_us;                 // Fechamento da janela (µs desde o boot)
+} resultado_aquisicao_t;
+
+void tarefa1_iniciar(dma_channel_config *cfg, int dma_chan, int dma_chan_b);
+bool tarefa1_janela_concluida(resultado_aquisicao_t *res);
+void tarefa1_configurar(const config_aquisicao_t *cfg);
+void tarefa1_definir_calibracao(const calib_temp_t *nova);
+
+// Chamado pelo handler do DMA ao concluir uma metade do ping-pong
+// (no modo sequenciado, uma janela inteira)
+void tarefa1_bloco_concluido(int metade);
+uint32_t tarefa1_blocos_perdidos(void);    // No modo sequenciado, janelas sobrescritas sem leitura
+uint32_t tarefa1_amostras_janela(void);    // N exato por janela (0 fora do modo sequenciado)
+uint32_t tarefa1_periodo_bloco_us(void);   // Intervalo nominal entre IRQs
+uint32_t tarefa1_folga_us(void);           // Até a próxima IRQ de bloco (UINT32_MAX com o ADC desligado)
+uint64_t tarefa1_adc_ligado_us(void);      // Tempo acumulado com o ADC ligado
+
+#endif
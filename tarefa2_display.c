@@ -4,12 +4,16 @@
  *  Projeto: TempCycleDMA
  * ------------------------------------------------------------
  *  Descrição:
- *      Tarefa 2 corrigida: exibe no display OLED duas linhas:
+ *      Tarefa 2 corrigida: exibe no display OLED o título, a
+ *      temperatura em fonte grande e a tendência:
  *
- *         TEMP: 32.4 C
- *         TEND: ESTAVEL
+ *         Temperatura          (página 0)
+ *         [gráfico]            (páginas 1–3, grafico_oled.c)
+ *         32.4                 (páginas 4–6)
+ *         TEMP: ESTAVEL        (página 7)
  *
- *      Ambas centralizadas horizontalmente, usando fonte padrão.
+ *      As páginas do gráfico não são tocadas aqui: o gráfico
+ *      desenha e envia as próprias colunas.
  *
  *  
  *  Data: 12/05/2025
@@ -22,37 +26,51 @@
 #include "display_utils.h"
 #include "tarefa2_display.h"
 #include "tarefa3_tendencia.h"
+#include "grafico_oled.h"
 
 extern uint8_t ssd[];
-extern struct render_area area;
 
-void tarefa2_exibir_oled(float temperatura, tendencia_t tendencia) {
-    ssd1306_clear_display(ssd);
-    render_on_display(ssd, &area);  // Garante que a limpeza seja visível
-    sleep_ms(20);                   // Pequeno delay opcional
+void tarefa2_exibir_oled(int32_t temp_mC, tendencia_t tendencia) {
+    // Geração do conteúdo: décimos de grau (o que a tela mostra) + tendência.
+    // Sem mudança não há o que redesenhar nem enviar.
+    static bool exibido = false;
+    static int32_t decimos_exibidos;
+    static tendencia_t tendencia_exibida;
+
+    int32_t decimos = (temp_mC + (temp_mC >= 0 ? 50 : -50)) / 100;
+    if (exibido && decimos == decimos_exibidos && tendencia == tendencia_exibida) {
+        return;
+    }
+
+    // Redesenha o texto só na memória (fora das páginas do gráfico); o envio compara com o painel
+    memset(ssd, 0, GRAFICO_PAGINA_INI * ssd1306_width);
+    memset(ssd + (GRAFICO_PAGINA_INI + GRAFICO_PAGINAS) * ssd1306_width, 0,
+           (ssd1306_n_pages - GRAFICO_PAGINA_INI - GRAFICO_PAGINAS) * ssd1306_width);
 
     char* linha1 = "Temperatura";
-    char* linha2 = "Media";
     char linha3[30];
 
     snprintf(linha3, sizeof(linha3), "TEMP: %s", tendencia_para_texto(tendencia));
 
     // Fonte padrão: 6 px por caractere, altura: 8 px
     int x1 = (128 - strlen(linha1) * 6) / 2;
-    int x2 = (128 - strlen(linha2) * 6) / 2;
     int x3 = (128 - strlen(linha3) * 6) / 2;
 
     // Y = linha × altura da fonte (8 px padrão)
     ssd1306_draw_string(ssd, x1, 0, linha1);    // Linha 0 (Y=0)
-    // Linha 1 = em branco (Y=8)
-    ssd1306_draw_string(ssd, x2, 16, linha2);   // Linha 2 (Y=16)
-    // Linha 3 = em branco (Y=24)
+    // Linhas 1–3 = gráfico (Y=8..31)
 
     // Fonte grande começa abaixo: Y=32 px
-    mostrar_valor_grande(ssd, temperatura, 32);
+    mostrar_valor_grande(ssd, temp_mC, 32);
 
     ssd1306_draw_string(ssd, 0, 56, linha3);  // Y = 32 
 
-    render_on_display(ssd, &area);
+    // Só as páginas/colunas alteradas vão por DMA; retorna sem esperar.
+    // Se o envio anterior ainda não terminou, o próximo ciclo leva a diferença.
+    if (ssd1306_flush_alteracoes(ssd, NULL)) {
+        exibido = true;
+        decimos_exibidos = decimos;
+        tendencia_exibida = tendencia;
+    }
 }
 
@@ -16,14 +16,15 @@
 #ifndef TAREFA2_DISPLAY_H
 #define TAREFA2_DISPLAY_H
 
+#include <stdint.h>
 #include "tarefa3_tendencia.h"  // necessário para tipo tendencia_t
 
 /**
  * @brief Exibe no OLED a temperatura média e a tendência térmica.
  *
- * @param temperatura Valor da temperatura média atual
+ * @param temp_mC Temperatura média atual, em m°C
  * @param tendencia Resultado da análise de tendência (subindo, caindo, estável)
  */
-void tarefa2_exibir_oled(float temperatura, tendencia_t tendencia);
+void tarefa2_exibir_oled(int32_t temp_mC, tendencia_t tendencia);
 
 #endif  // TAREFA2_DISPLAY_H
@@ -20,18 +20,22 @@
 #include <string.h>
 #include "ssd1306.h"
 #include "display_utils.h"
+#include "formatacao.h"
 #include "tarefa2_display.h"
 #include "tarefa3_tendencia.h"
 
 extern uint8_t ssd[];
 extern struct render_area area;
 
-void tarefa2_exibir_oled(float temperatura, tendencia_t tendencia) {
+void tarefa2_exibir_oled(int32_t temp_mC, tendencia_t tendencia) {
     ssd1306_clear_display(ssd);
 
     // === Linha 1: temperatura média ===
-    char linha_temp[20];
-    snprintf(linha_temp, sizeof(linha_temp), "TEMP: %.1f C", temperatura);
+    char linha_temp[20] = "TEMP: ";
+    uint8_t n = 6 + formatar_mC(linha_temp + 6, temp_mC, 1, false);
+    linha_temp[n++] = ' ';
+    linha_temp[n++] = 'C';
+    linha_temp[n] = '\0';
     int x1 = (128 - strlen(linha_temp) * 6) / 2;
     ssd1306_draw_string(ssd, x1, 16, linha_temp);  // Y = 16 px (linha 2)
 
@@ -7,19 +7,26 @@
  *      Este módulo implementa a Tarefa 3 do executor cíclico:
  *      a análise de tendência da temperatura.
  *      
- *      A função compara a temperatura atual com a anterior
- *      e classifica como:
+ *      As médias de temperatura entram num anel de tamanho
+ *      fixo e a inclinação é a reta de mínimos quadrados sobre
+ *      as últimas N médias, convertida para °C/min. A reta é
+ *      mantida por somas incrementais em inteiros (Σy e Σxy,
+ *      com Σx e Σx² em forma fechada), então cada atualização
+ *      custa o mesmo para qualquer N. A inclinação passa por
+ *      uma média móvel exponencial e é classificada como:
  *          - TENDÊNCIA_SUBINDO
  *          - TENDÊNCIA_CAINDO
  *          - TENDÊNCIA_ESTÁVEL
  *
- *      A tendência é detectada com base em um limiar mínimo
- *      de variação (±0.05°C) e pode ser exibida no terminal
- *      ou no display OLED.
+ *      A classificação tem histerese: sai de ESTÁVEL acima de
+ *      um limiar e só volta abaixo de um limiar menor, para o
+ *      ruído do ADC não ficar alternando a tendência (e
+ *      redesenhando o OLED e a matriz).
  * 
  *  Funcionalidades:
- *      - Armazena a última temperatura registrada
- *      - Retorna enum `tendencia_t` representando o estado
+ *      - Janela, período, suavização e limiares configuráveis
+ *        ('config_tendencia_t', definida em 'setup.c')
+ *      - Retorna enum `tendencia_t` e a inclinação em °C/min
  *      - Oferece função auxiliar para converter enum em string
  *
  *  Relacionamento:
@@ -31,30 +38,115 @@
  * ------------------------------------------------------------
  */
 
+#include <stddef.h>
 #include "tarefa3_tendencia.h"
 
-static float temperatura_anterior = 0.0f;
-static int primeiro_ciclo = 1;
+static config_tendencia_t cfg = CONFIG_TENDENCIA_PADRAO;
 
-tendencia_t tarefa3_analisa_tendencia(float atual) {
-    tendencia_t resultado;
+static int32_t anel[TENDENCIA_JANELA_MAX];   // Médias (m°C); anel[inicio] é a mais antiga
+static uint16_t inicio = 0;
+static uint16_t n = 0;
+static int64_t soma_y = 0;                   // Σ y
+static int64_t soma_xy = 0;                  // Σ x·y, com x = 0 na média mais antiga
+static int64_t inclinacao_q8 = 0;            // Inclinação suavizada (m°C/min × 256)
+static tendencia_t estado = TENDENCIA_ESTÁVEL;
+
+static int64_t dividir_arredondado(int64_t num, int64_t den) {
+    return (num >= 0 ? num + den / 2 : num - den / 2) / den;
+}
+
+void tarefa3_configurar(const config_tendencia_t *nova) {
+    cfg = *nova;
+    if (cfg.janela < 2) cfg.janela = 2;
+    if (cfg.janela > TENDENCIA_JANELA_MAX) cfg.janela = TENDENCIA_JANELA_MAX;
+    if (cfg.periodo_ms == 0) cfg.periodo_ms = 1;
+    if (cfg.suavizacao > 8) cfg.suavizacao = 8;
+    if (cfg.limiar_mC_min < 0) cfg.limiar_mC_min = 0;
+    if (cfg.limiar_volta_mC_min < 0) cfg.limiar_volta_mC_min = 0;
+    if (cfg.limiar_volta_mC_min > cfg.limiar_mC_min) cfg.limiar_volta_mC_min = cfg.limiar_mC_min;
 
-    if (primeiro_ciclo) {
-        resultado = TENDENCIA_ESTÁVEL;
-        primeiro_ciclo = 0;
+    inicio = 0;
+    n = 0;
+    soma_y = 0;
+    soma_xy = 0;
+    inclinacao_q8 = 0;
+    estado = TENDENCIA_ESTÁVEL;
+}
+
+// Desliza a janela: a mais antiga sai, as demais descem um x, a nova entra no fim
+static void inserir(int32_t y) {
+    if (n < cfg.janela) {
+        anel[n] = y;                 // inicio = 0 enquanto o anel enche
+        soma_xy += (int64_t)n * y;
+        soma_y += y;
+        n++;
+        return;
+    }
+
+    int32_t velho = anel[inicio];
+    soma_xy += (int64_t)(n - 1) * y - (soma_y - velho);
+    soma_y += y - velho;
+    anel[inicio] = y;
+    if (++inicio == cfg.janela) inicio = 0;
+}
+
+// Inclinação da reta de mínimos quadrados, em m°C/min
+static int32_t inclinacao_mC_min(void) {
+    if (n < 2) return 0;
+
+    const int64_t k = n;
+    const int64_t soma_x = k * (k - 1) / 2;
+    const int64_t num = k * soma_xy - soma_x * soma_y;
+    const int64_t den = k * k * (k * k - 1) / 12;   // k·Σx² − (Σx)²
+
+    return (int32_t)dividir_arredondado(num * 60000, den * cfg.periodo_ms);
+}
+
+static tendencia_t classificar(int32_t s) {
+    const int32_t entra = cfg.limiar_mC_min, volta = cfg.limiar_volta_mC_min;
+
+    // Com poucas médias a reta segue o ruído; só decide com a janela cheia
+    if (n < cfg.janela) return TENDENCIA_ESTÁVEL;
+
+    switch (estado) {
+        case TENDENCIA_SUBINDO:
+            if (s <= -entra) return TENDENCIA_CAINDO;
+            return (s < volta) ? TENDENCIA_ESTÁVEL : TENDENCIA_SUBINDO;
+        case TENDENCIA_CAINDO:
+            if (s >= entra) return TENDENCIA_SUBINDO;
+            return (s > -volta) ? TENDENCIA_ESTÁVEL : TENDENCIA_CAINDO;
+        default:
+            if (s >= entra) return TENDENCIA_SUBINDO;
+            if (s <= -entra) return TENDENCIA_CAINDO;
+            return TENDENCIA_ESTÁVEL;
+    }
+}
+
+tendencia_t tarefa3_atualizar(int32_t temp_mC, resultado_tendencia_t *res) {
+    inserir(temp_mC);
+
+    // EWMA em Q8 para a suavização não parar em passos menores que 1 m°C/min
+    int64_t alvo_q8 = (int64_t)inclinacao_mC_min() * 256;
+    if (n == 1) {
+        inclinacao_q8 = 0;
     } else {
-        float delta = atual - temperatura_anterior;
-
-        if (delta > 0.01f)
-            resultado = TENDENCIA_SUBINDO;
-        else if (delta < -0.01f)
-            resultado = TENDENCIA_CAINDO;
-        else
-            resultado = TENDENCIA_ESTÁVEL;
+        inclinacao_q8 += (alvo_q8 - inclinacao_q8) / (1 << cfg.suavizacao);
+    }
+
+    int32_t s = (int32_t)dividir_arredondado(inclinacao_q8, 256);
+    estado = classificar(s);
+
+    if (res) {
+        res->tendencia = estado;
+        res->inclinacao_mC_min = s;
+        res->inclinacao_c_min = s / 1000.0f;
+        res->amostras = n;
     }
+    return estado;
+}
 
-    temperatura_anterior = atual;
-    return resultado;
+tendencia_t tarefa3_analisa_tendencia(float atual) {
+    return tarefa3_atualizar((int32_t)(atual * 1000.0f + (atual >= 0.0f ? 0.5f : -0.5f)), NULL);
 }
 
 const char* tendencia_para_texto(tendencia_t t) {
@@ -9,7 +9,10 @@
  *
  *      Fornece:
  *        - Enumeração `tendencia_t` com os três estados possíveis
- *        - Função para determinar a tendência com base na temperatura atual
+ *        - Configuração do estimador (janela, período, suavização
+ *          e limiares com histerese)
+ *        - Função para determinar a tendência e a inclinação
+ *          (°C/min) a cada nova média de temperatura
  *        - Função para converter a tendência em texto
  *
  *  
@@ -20,6 +23,8 @@
 #ifndef TAREFA3_TENDENCIA_H
 #define TAREFA3_TENDENCIA_H
 
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -31,8 +36,55 @@ typedef enum {
     TENDENCIA_CAINDO
 } tendencia_t;
 
+// Maior janela do ajuste (médias guardadas no anel)
+#define TENDENCIA_JANELA_MAX 64
+
+// Parâmetros do estimador de tendência
+typedef struct {
+    uint16_t janela;              // Médias no ajuste por mínimos quadrados (2..TENDENCIA_JANELA_MAX)
+    uint32_t periodo_ms;          // Intervalo entre duas médias (período de quem chama)
+    uint8_t  suavizacao;          // EWMA da inclinação com alfa = 1/2^suavizacao (0 = sem)
+    int32_t  limiar_mC_min;       // |inclinação| para sair de ESTÁVEL (m°C/min)
+    int32_t  limiar_volta_mC_min; // |inclinação| abaixo da qual volta a ESTÁVEL (histerese)
+} config_tendencia_t;
+
+// 60 médias a cada 0,5 s (30 s de ajuste), alfa 1/2, entra a 0,3 °C/min e sai a 0,15 °C/min
+#define CONFIG_TENDENCIA_PADRAO { 60u, 500u, 1u, 300, 150 }
+
+// Saída de uma atualização
+typedef struct {
+    tendencia_t tendencia;
+    float    inclinacao_c_min;    // Inclinação suavizada (°C/min)
+    int32_t  inclinacao_mC_min;   // A mesma, em m°C/min
+    uint16_t amostras;            // Médias no ajuste (< janela enquanto enche)
+} resultado_tendencia_t;
+
+/**
+ * @brief Troca os parâmetros do estimador e descarta o histórico.
+ *
+ * Valores fora da faixa são ajustados (janela limitada a
+ * TENDENCIA_JANELA_MAX, limiar de volta ≤ limiar de entrada).
+ */
+void tarefa3_configurar(const config_tendencia_t *cfg);
+
+/**
+ * @brief Entra com uma nova média e atualiza a tendência em tempo constante.
+ *
+ * A inclinação é a reta de mínimos quadrados sobre as últimas 'janela'
+ * médias, mantida por somas incrementais (Σy, Σxy), suavizada por EWMA.
+ * A tendência só muda ao cruzar os limiares com histerese, e só sai de
+ * ESTÁVEL depois que a janela enche.
+ *
+ * @param temp_mC Média da janela de temperatura (m°C)
+ * @param res Inclinação e tendência (pode ser NULL)
+ * @return tendência identificada
+ */
+tendencia_t tarefa3_atualizar(int32_t temp_mC, resultado_tendencia_t *res);
+
 /**
- * @brief Analisa a tendência com base na temperatura atual e anterior.
+ * @brief Analisa a tendência a partir da temperatura atual.
+ *
+ * Mesmo estimador de tarefa3_atualizar(), com a temperatura em °C.
  *
  * @param atual Temperatura atual (ºC)
  * @return tendência identificada
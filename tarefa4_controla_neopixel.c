@@ -13,13 +13,15 @@
  *         - Tendência ESTÁVEL → matriz toda VERDE
  *         - Tendência CAINDO  → matriz toda AZUL
  *
- *      As cores são aplicadas a todos os LEDs simultaneamente,
- *      utilizando a função npSetAll() do driver de NeoPixels.
+ *      A cor vai para a camada base do motor de animação
+ *      (LabNeoPixel/animacao.c), com transição suave entre
+ *      tendências; o envio aos LEDs acontece em efeito_tick().
  *
  *  Relacionamento:
  *      - Depende de `tarefa3_tendencia.h` para o enum `tendencia_t`
- *      - Usa `neopixel_driver.h` para acionar os LEDs
- *      - Requer definições simbólicas de cores (ex: `COR_AZUL`)
+ *      - Usa `animacao.h` para compor e acionar os LEDs
+ *      - Cores padrão vêm das definições simbólicas (ex: `COR_AZUL`);
+ *        os valores em uso ficam em `cores_tendencia[]` (setup.c)
  *
  *  
  *  Data: 12/05/2025
@@ -27,8 +29,9 @@
  */
 
 #include "neopixel_driver.h"
+#include "animacao.h"
 #include "tarefa3_tendencia.h"
-#include "testes_cores.h"  // contém COR_AZUL, COR_VERDE, COR_VERMELHO
+#include "tarefa4_controla_neopixel.h"
 
 /**
  * @brief Define a cor de todos os LEDs da matriz de acordo com a tendência.
@@ -36,17 +39,9 @@
  * @param t Tendência térmica detectada (subindo, caindo, estável)
  */
 void tarefa4_matriz_cor_por_tendencia(tendencia_t t) {
-    switch (t) {
-        case TENDENCIA_CAINDO:
-            npSetAll(COR_AZUL);     // Azul
-            break;
-        case TENDENCIA_ESTÁVEL:
-            npSetAll(COR_VERDE);    // Verde
-            break;
-        case TENDENCIA_SUBINDO:
-            npSetAll(COR_VERMELHO); // Vermelho
-            break;
-    }
+    uint32_t cor = cores_tendencia[t];
+    anim_efeito_t efeito = { ANIM_SOLIDO, (uint8_t)(cor >> 16), (uint8_t)(cor >> 8), (uint8_t)cor, 0, false };
 
-    npWrite();  // Atualiza fisicamente a matriz
+    // A mesma tendência (e cor) não reinicia o efeito; uma nova faz fade em 400 ms
+    anim_iniciar(ANIM_CAMADA_BASE, &efeito, 400);
 }
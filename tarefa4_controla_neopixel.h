@@ -24,6 +24,20 @@
 #define TAREFA4_CONTROLA_NEOPIXEL_H
 
 #include "tarefa3_tendencia.h"  // para o tipo tendencia_t
+#include "testes_cores.h"
+
+// Cor 0xRRGGBB a partir de uma tripla (ex.: COR_HEX(COR_VERDE))
+#define COR_HEX(...) COR_HEX_(__VA_ARGS__)
+#define COR_HEX_(r, g, b) (((uint32_t)(r) << 16) | ((uint32_t)(g) << 8) | (uint32_t)(b))
+
+#define CORES_TENDENCIA_PADRAO {                \
+    [TENDENCIA_ESTÁVEL] = COR_HEX(COR_VERDE),    \
+    [TENDENCIA_SUBINDO] = COR_HEX(COR_VERMELHO), \
+    [TENDENCIA_CAINDO]  = COR_HEX(COR_AZUL),     \
+}
+
+// Cor de cada tendência (0xRRGGBB), ajustável pelo console; definida em 'setup.c'
+extern uint32_t cores_tendencia[3];
 
 #ifdef __cplusplus
 extern "C" {
@@ -0,0 +1,159 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: telemetria.c
+ *  Projeto: TempCycleDMA
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Anel de registros de telemetria e dreno para o USB CDC.
+ *
+ *      Produtor e consumidores rodam no núcleo 0 em contexto de
+ *      thread (tarefas do executor e tempo ocioso); cada um
+ *      escreve apenas o seu índice, então não há trava. Com o
+ *      leitor da rede ligado, o produtor respeita a cauda mais
+ *      atrasada das duas.
+ *
+ *      O dreno só monta uma moldura quando o CDC tem espaço
+ *      para ela inteira ('tud_cdc_write_available') e a entrega
+ *      de uma vez ao driver USB do stdio (uma passada pelo
+ *      mutex e um flush por lote), que nunca espera pelo host. Sem
+ *      host conectado o anel simplesmente enche e passa a
+ *      descartar.
+ *
+ *  Relacionamento:
+ *      - Registros gerados em 'main.c' e 'executor.c'.
+ *      - Drenado pelo laço ocioso do executor.
+ *
+ *  
+ *  Data: 14/10/2026
+ * ------------------------------------------------------------
+ */
+
+#include <string.h>
+#include "pico/stdlib.h"
+#include "pico/stdio_usb.h"
+#include "pico/stdio/driver.h"
+#include "tusb.h"
+#include "telemetria.h"
+
+#define TELEM_MASCARA (TELEMETRIA_CAPACIDADE - 1u)
+#define TELEM_SYNC0 0xA5
+#define TELEM_SYNC1 0x5A
+#define TELEM_CABECALHO 4u   // sync (2) + n + lote
+#define TELEM_RODAPE 2u      // CRC16
+
+_Static_assert(TELEMETRIA_TAMANHO_LOTE(1) == TELEM_CABECALHO + sizeof(registro_telemetria_t) + TELEM_RODAPE,
+               "TELEMETRIA_TAMANHO_LOTE fora do formato da moldura");
+
+static registro_telemetria_t anel[TELEMETRIA_CAPACIDADE];
+static volatile uint32_t cabeca = 0;
+static volatile uint32_t cauda = 0;
+static uint32_t descartes = 0;
+static uint16_t seq = 0;
+static uint8_t lote = 0;
+static uint8_t moldura_usb[TELEMETRIA_TAMANHO_LOTE(TELEMETRIA_MAX_POR_LOTE)];
+
+// Segundo leitor (rede): só segura o anel enquanto ligado
+static volatile uint32_t cauda_rede = 0;
+static bool leitor_rede = false;
+static uint8_t lote_rede = 0;
+
+void telemetria_registrar(uint8_t tipo, uint8_t origem, int32_t valor, uint32_t duracao_us) {
+    uint32_t c = cabeca;
+    uint32_t lenta = cauda;
+    if (leitor_rede && (int32_t)(cauda_rede - lenta) < 0) lenta = cauda_rede;
+    if (c - lenta >= TELEMETRIA_CAPACIDADE) {
+        descartes++;
+        seq++;   // A lacuna na sequência mostra a perda no host
+        return;
+    }
+
+    registro_telemetria_t *r = &anel[c & TELEM_MASCARA];
+    r->tipo = tipo;
+    r->origem = origem;
+    r->seq = seq++;
+    r->timestamp_us = time_us_32();
+    r->valor = valor;
+    r->duracao_us = duracao_us;
+    cabeca = c + 1;
+}
+
+/**
+ * @brief CRC-16/CCITT-FALSE incremental (poli 0x1021).
+ */
+static uint16_t crc16(uint16_t crc, const uint8_t *dados, uint32_t n) {
+    while (n--) {
+        crc ^= (uint16_t)(*dados++) << 8;
+        for (int b = 0; b < 8; b++) {
+            crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+/**
+ * @brief Monta uma moldura com 'n' registros a partir da cauda 't',
+ *        direto do anel para o destino.
+ *
+ * @return Tamanho da moldura em bytes.
+ */
+static uint32_t montar_moldura(uint8_t *destino, uint32_t t, uint8_t n, uint8_t num_lote) {
+    destino[0] = TELEM_SYNC0;
+    destino[1] = TELEM_SYNC1;
+    destino[2] = n;
+    destino[3] = num_lote;
+
+    uint8_t *d = destino + TELEM_CABECALHO;
+    for (uint8_t i = 0; i < n; i++) {
+        memcpy(d, &anel[(t + i) & TELEM_MASCARA], sizeof(registro_telemetria_t));
+        d += sizeof(registro_telemetria_t);
+    }
+    uint16_t crc = crc16(0xFFFF, destino + 2, (uint32_t)(d - destino - 2));
+    d[0] = (uint8_t)crc;
+    d[1] = (uint8_t)(crc >> 8);
+    return TELEMETRIA_TAMANHO_LOTE(n);
+}
+
+void telemetria_drenar(void) {
+    while (cabeca != cauda) {
+        if (!stdio_usb_connected()) {
+            // Sem host no USB o anel fica para a rede: a cauda do USB acompanha a dela
+            if (leitor_rede && (int32_t)(cauda_rede - cauda) > 0) cauda = cauda_rede;
+            return;
+        }
+
+        uint32_t pendentes = cabeca - cauda;
+        uint8_t n = pendentes > TELEMETRIA_MAX_POR_LOTE ? TELEMETRIA_MAX_POR_LOTE : (uint8_t)pendentes;
+        if (tud_cdc_write_available() < TELEMETRIA_TAMANHO_LOTE(n)) return;   // Tenta no próximo ocioso
+
+        // Moldura inteira direto no driver USB, sem tradução de CR/LF
+        uint32_t tamanho = montar_moldura(moldura_usb, cauda, n, lote++);
+        stdio_usb.out_chars((const char *)moldura_usb, (int)tamanho);
+        cauda += n;
+    }
+}
+
+uint32_t telemetria_descartes(void) {
+    return descartes;
+}
+
+void telemetria_leitor_rede(bool ligado) {
+    cauda_rede = cabeca;
+    leitor_rede = ligado;
+}
+
+uint32_t telemetria_pendentes_rede(void) {
+    return leitor_rede ? cabeca - cauda_rede : 0;
+}
+
+uint32_t telemetria_montar_lote_rede(uint8_t *destino, uint8_t max, uint8_t *n) {
+    uint32_t pendentes = telemetria_pendentes_rede();
+    *n = pendentes > max ? max : (uint8_t)pendentes;
+    if (*n == 0) return 0;
+
+    return montar_moldura(destino, cauda_rede, *n, lote_rede);
+}
+
+void telemetria_consumir_rede(uint8_t n) {
+    cauda_rede += n;
+    lote_rede++;
+}
@@ -0,0 +1,108 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: telemetria.h
+ *  Projeto: TempCycleDMA
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Canal de telemetria binária não bloqueante.
+ *
+ *      As tarefas registram registros compactos de tamanho fixo
+ *      (16 bytes) num anel sem trava; o custo no caminho quente
+ *      é uma cópia e uma atualização de índice, sem formatação
+ *      de texto nem espera pelo USB. Um dreno de baixa
+ *      prioridade, chamado no tempo ocioso do executor, envia
+ *      os registros ao host em lotes com moldura e CRC, apenas
+ *      quando há espaço no buffer do CDC.
+ *
+ *      Formato do lote (little-endian):
+ *          A5 5A | n (1) | lote (1) | n × registro (16) | CRC16 (2)
+ *      O CRC-16/CCITT (0xFFFF) cobre de 'n' até o último registro.
+ *      O decodificador do host está em 'tools/telemetria.py'.
+ *
+ *      No build com Wi-Fi um segundo leitor ('telemetria_rede.c')
+ *      consome o mesmo anel e manda as mesmas molduras por UDP.
+ *
+ *  
+ *  Data: 14/10/2026
+ * ------------------------------------------------------------
+ */
+
+#ifndef TELEMETRIA_H
+#define TELEMETRIA_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef TELEMETRIA_CAPACIDADE
+#define TELEMETRIA_CAPACIDADE 64      // Registros no anel (potência de 2)
+#endif
+#define TELEMETRIA_MAX_POR_LOTE 8     // Registros por moldura USB
+
+// Bytes de uma moldura com n registros (sync, n, lote, registros, CRC)
+#define TELEMETRIA_TAMANHO_LOTE(n) (4u + (n) * 16u + 2u)
+
+// Tipos de registro
+typedef enum {
+    TELEM_TEMPERATURA = 1,   // valor: média da janela (m°C)
+    TELEM_TENDENCIA   = 2,   // valor: tendencia_t
+    TELEM_TAREFA      = 3,   // valor: atraso de início (µs); duracao: execução
+    TELEM_EVENTO      = 4,   // valor: código TELEM_EV_*
+    TELEM_ROBUSTA     = 5,   // valor: mediana da janela (m°C); duracao: desvio padrão (m°C)
+} telem_tipo_t;
+
+// Códigos de TELEM_EVENTO
+enum {
+    TELEM_EV_PRIMEIRA_LEITURA = 1,
+    TELEM_EV_REDE_LACUNA      = 2,   // duracao: ms sem enlace (médias no histórico da flash)
+};
+
+typedef struct __attribute__((packed)) {
+    uint8_t  tipo;           // telem_tipo_t
+    uint8_t  origem;         // Tarefa/ponto que gerou o registro
+    uint16_t seq;            // Sequência (detecta perdas no host)
+    uint32_t timestamp_us;   // time_us_32() no registro
+    int32_t  valor;
+    uint32_t duracao_us;
+} registro_telemetria_t;
+
+/**
+ * @brief Registra um item (contexto de thread do núcleo 0).
+ *
+ * Nunca bloqueia: com o anel cheio o registro é descartado e contado.
+ */
+void telemetria_registrar(uint8_t tipo, uint8_t origem, int32_t valor, uint32_t duracao_us);
+
+/**
+ * @brief Envia ao USB o que couber, em lotes (chamar no tempo ocioso).
+ */
+void telemetria_drenar(void);
+
+/**
+ * @brief Registros descartados por anel cheio.
+ */
+uint32_t telemetria_descartes(void);
+
+/**
+ * @brief Liga ou desliga o segundo leitor do anel (telemetria pela rede).
+ *
+ * Ligado, o anel só libera um registro depois que os dois leitores o
+ * consumiram; ao ligar, o leitor começa do registro mais novo.
+ */
+void telemetria_leitor_rede(bool ligado);
+
+uint32_t telemetria_pendentes_rede(void);
+
+/**
+ * @brief Monta em 'destino' uma moldura com até 'max' registros pendentes
+ *        da rede, sem consumi-los (mesmo formato do USB).
+ *
+ * @return tamanho em bytes (0 = nada pendente); '*n' recebe os registros
+ */
+uint32_t telemetria_montar_lote_rede(uint8_t *destino, uint8_t max, uint8_t *n);
+
+/**
+ * @brief Libera os registros de uma moldura que a rede aceitou.
+ */
+void telemetria_consumir_rede(uint8_t n);
+
+#endif  // TELEMETRIA_H
@@ -0,0 +1,208 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: telemetria_rede.c
+ *  Projeto: TempCycleDMA
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Envio dos lotes de telemetria por UDP pelo cyw43.
+ *
+ *      Os pbufs são alocados uma vez em rede_iniciar(); a
+ *      moldura é montada direto no payload deles a partir do
+ *      anel. Um pbuf só é reutilizado quando o lwIP já o
+ *      soltou (ref == 1; ex.: não está esperando o ARP).
+ *
+ *      Rede, SSID e destino vêm do CMake (TEMPCYCLE_WIFI_SSID,
+ *      TEMPCYCLE_WIFI_SENHA, TEMPCYCLE_UDP_DESTINO). O script
+ *      'tools/telemetria.py --udp <porta>' decodifica os lotes.
+ *
+ *  Relacionamento:
+ *      - Anel e molduras de 'telemetria.c'
+ *      - Iniciado em 'setup.c', servido no ocioso de 'main.c'
+ *      - Relatório no console ('console.c')
+ *
+ *
+ *  Data: 14/10/2026
+ * ------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "pico/cyw43_arch.h"
+#include "lwip/pbuf.h"
+#include "lwip/udp.h"
+#include "telemetria_rede.h"
+
+#define REDE_ORIGEM 0x80   // Fora das origens das tarefas (executor / main)
+#define REDE_TAMANHO_PACOTE TELEMETRIA_TAMANHO_LOTE(REDE_REGISTROS_POR_LOTE)
+
+typedef struct {
+    struct pbuf *p;
+    void *dados;       // Payload original (o lwIP deixa os cabeçalhos no pbuf reaproveitado)
+} lote_rede_t;
+
+static config_rede_t cfg = CONFIG_REDE_PADRAO;
+static bool iniciada = false;
+static struct udp_pcb *pcb = NULL;
+static ip_addr_t destino;
+static lote_rede_t lotes[REDE_PBUFS];
+
+static bool com_enlace = false;
+static bool no_anel = true;         // Leitor da rede segurando o anel
+static uint32_t queda_ms;           // Início da queda corrente (ou do boot)
+static uint32_t tentativa_ms;
+static uint32_t ultimo_envio_ms;
+
+static struct {
+    uint32_t lotes, registros, bytes;
+    uint32_t recusados;    // udp_sendto com erro (registros ficaram no anel)
+    uint32_t sem_pbuf;     // Lote devido sem pbuf livre
+    uint32_t quedas, lacunas;
+} est;
+
+static uint32_t agora_ms(void) {
+    return to_ms_since_boot(get_absolute_time());
+}
+
+static void conectar(void) {
+    tentativa_ms = agora_ms();
+    cyw43_arch_wifi_connect_async(TEMPCYCLE_WIFI_SSID, TEMPCYCLE_WIFI_SENHA, CYW43_AUTH_WPA2_AES_PSK);
+}
+
+void rede_configurar(const config_rede_t *c) {
+    cfg = *c;
+    if (cfg.intervalo_ms < 100u) cfg.intervalo_ms = 100u;
+    if (cfg.porta == 0u) cfg.porta = 5005u;
+}
+
+bool rede_iniciar(const config_rede_t *c) {
+    rede_configurar(c);
+    if (cyw43_arch_init()) {
+        printf("rede: cyw43 nao iniciou, telemetria so pelo USB\n");
+        return false;
+    }
+    cyw43_arch_enable_sta_mode();
+
+    cyw43_arch_lwip_begin();
+    pcb = udp_new_ip_type(IPADDR_TYPE_V4);
+    bool alocados = pcb != NULL;
+    for (int i = 0; i < REDE_PBUFS; i++) {
+        lotes[i].p = pbuf_alloc(PBUF_TRANSPORT, REDE_TAMANHO_PACOTE, PBUF_RAM);
+        lotes[i].dados = lotes[i].p ? lotes[i].p->payload : NULL;
+        alocados = alocados && lotes[i].p;
+    }
+    cyw43_arch_lwip_end();
+
+    if (!alocados || !ipaddr_aton(TEMPCYCLE_UDP_DESTINO, &destino)) {
+        printf("rede: sem memoria no lwIP ou destino invalido (%s)\n", TEMPCYCLE_UDP_DESTINO);
+        return false;
+    }
+
+    // Segura o anel desde o boot: o que vier antes do enlace sai no primeiro lote
+    telemetria_leitor_rede(true);
+    queda_ms = agora_ms();
+    iniciada = true;
+    conectar();
+    return true;
+}
+
+static lote_rede_t *lote_livre(void) {
+    for (int i = 0; i < REDE_PBUFS; i++) {
+        if (lotes[i].p->ref == 1) return &lotes[i];
+    }
+    return NULL;
+}
+
+// Monta e entrega um lote; false se não havia o que enviar ou o lwIP recusou
+static bool enviar_lote(void) {
+    if (!telemetria_pendentes_rede()) return false;
+
+    lote_rede_t *l = lote_livre();
+    if (!l) {
+        est.sem_pbuf++;
+        return false;
+    }
+
+    uint8_t n;
+    uint32_t tamanho = telemetria_montar_lote_rede(l->dados, REDE_REGISTROS_POR_LOTE, &n);
+
+    // Um só segmento, alocado com o tamanho máximo: basta repor payload e comprimento
+    l->p->payload = l->dados;
+    l->p->len = l->p->tot_len = (u16_t)tamanho;
+
+    cyw43_arch_lwip_begin();
+    err_t err = udp_sendto(pcb, l->p, &destino, cfg.porta);
+    cyw43_arch_lwip_end();
+    if (err != ERR_OK) {
+        est.recusados++;   // Os registros ficam no anel para a próxima tentativa
+        return false;
+    }
+
+    telemetria_consumir_rede(n);
+    est.lotes++;
+    est.registros += n;
+    est.bytes += tamanho;
+    return true;
+}
+
+void rede_servico(void) {
+    if (!iniciada) return;
+
+    uint32_t agora = agora_ms();
+    int estado = cyw43_tcpip_link_status(&cyw43_state, CYW43_ITF_STA);
+
+    if (estado != CYW43_LINK_UP) {
+        if (com_enlace) {
+            com_enlace = false;
+            queda_ms = agora;
+            est.quedas++;
+        }
+        // Queda longa: solta o anel (USB e descartes seguem normais; as médias ficam na flash)
+        if (no_anel && (agora - queda_ms > REDE_ESPERA_MAX_MS ||
+                        telemetria_pendentes_rede() >= TELEMETRIA_CAPACIDADE / 2)) {
+            telemetria_leitor_rede(false);
+            no_anel = false;
+        }
+        bool tentando = estado == CYW43_LINK_JOIN || estado == CYW43_LINK_NOIP;
+        if (!tentando && agora - tentativa_ms >= REDE_RECONEXAO_MS) conectar();
+        return;
+    }
+
+    if (!com_enlace) {
+        com_enlace = true;
+        if (!no_anel) {
+            telemetria_leitor_rede(true);
+            no_anel = true;
+            est.lacunas++;
+            telemetria_registrar(TELEM_EVENTO, REDE_ORIGEM, TELEM_EV_REDE_LACUNA, agora - queda_ms);
+        }
+    }
+
+    uint32_t pendentes = telemetria_pendentes_rede();
+    if (pendentes >= REDE_REGISTROS_POR_LOTE ||
+        (pendentes && agora - ultimo_envio_ms >= cfg.intervalo_ms)) {
+        while (enviar_lote()) {
+        }
+        ultimo_envio_ms = agora;
+    }
+}
+
+void rede_relatorio(void) {
+    static const char *const estados[] = { "falhou", "sem rede", "senha recusada" };
+
+    if (!iniciada) {
+        printf("Rede: desligada\n");
+        return;
+    }
+    int estado = cyw43_tcpip_link_status(&cyw43_state, CYW43_ITF_STA);
+    const char *nome = estado == CYW43_LINK_UP ? "conectada"
+                     : estado >= 0 ? "conectando"
+                     : estados[(-estado - 1) % 3];
+
+    printf("Rede: %s -> %s:%u a cada %u ms | leitor %s | pendentes %lu\n", nome,
+           TEMPCYCLE_UDP_DESTINO, cfg.porta, cfg.intervalo_ms, no_anel ? "no anel" : "solto",
+           (unsigned long)telemetria_pendentes_rede());
+    printf("  lotes %lu (%lu registros, %lu B) | recusados %lu | sem pbuf %lu | quedas %lu | lacunas %lu\n",
+           (unsigned long)est.lotes, (unsigned long)est.registros, (unsigned long)est.bytes,
+           (unsigned long)est.recusados, (unsigned long)est.sem_pbuf, (unsigned long)est.quedas,
+           (unsigned long)est.lacunas);
+}
@@ -0,0 +1,71 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: telemetria_rede.h
+ *  Projeto: TempCycleDMA
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Telemetria por Wi-Fi (UDP) no Pico W, compilada com
+ *      TEMPCYCLE_WIFI.
+ *
+ *      Os registros do anel de 'telemetria.c' saem em lotes
+ *      (as mesmas molduras do USB, até REDE_REGISTROS_POR_LOTE
+ *      por datagrama), montados direto em pbufs alocados no
+ *      início. Um lote sai a cada 'intervalo_ms', ou antes se
+ *      já houver um lote cheio.
+ *
+ *      O cyw43 e o lwIP rodam no modo 'threadsafe_background'
+ *      (IRQ de prioridade mais baixa), e o DMA do ADC tem
+ *      prioridade mais alta: o rádio nunca atrasa a aquisição.
+ *
+ *      Sem enlace (ou com o lwIP sem memória) os registros
+ *      ficam no anel. Se a queda passa de REDE_ESPERA_MAX_MS
+ *      ou o anel chega à metade, o leitor da rede solta o
+ *      anel: as médias do período continuam no histórico da
+ *      flash, e na volta um TELEM_EV_REDE_LACUNA marca o
+ *      intervalo perdido.
+ *
+ *
+ *  Data: 14/10/2026
+ * ------------------------------------------------------------
+ */
+
+#ifndef TELEMETRIA_REDE_H
+#define TELEMETRIA_REDE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "telemetria.h"
+
+#ifndef TEMPCYCLE_WIFI
+#define TEMPCYCLE_WIFI 0
+#endif
+
+#define REDE_REGISTROS_POR_LOTE 32    // 518 B por datagrama (abaixo do MTU)
+#define REDE_PBUFS 2                  // Lotes no lwIP ao mesmo tempo
+#define REDE_ESPERA_MAX_MS 5000u      // Sem enlace por mais que isto: solta o anel
+#define REDE_RECONEXAO_MS 10000u      // Intervalo entre tentativas de conexão
+
+typedef struct {
+    uint16_t intervalo_ms;     // Período de envio dos lotes
+    uint16_t porta;            // Porta UDP de destino
+} config_rede_t;
+
+#define CONFIG_REDE_PADRAO { 2000u, 5005u }
+
+/**
+ * @brief Liga o rádio, começa a conexão (sem esperar) e aloca os pbufs.
+ *
+ * @return false se o cyw43 ou o lwIP não iniciaram (telemetria só pelo USB)
+ */
+bool rede_iniciar(const config_rede_t *cfg);
+
+void rede_configurar(const config_rede_t *cfg);
+
+/**
+ * @brief Acompanha o enlace e envia os lotes devidos (chamar no ocioso).
+ */
+void rede_servico(void);
+
+void rede_relatorio(void);
+
+#endif  // TELEMETRIA_REDE_H
@@ -0,0 +1,103 @@
+#!/usr/bin/env python3
+"""
+Gera a fonte grande em formato de páginas do SSD1306.
+
+Os glifos 16x32 de inc/font_big_logo_data.c estão em linhas (2 bytes por
+linha, MSB à esquerda). A memória do display é por página/coluna: cada
+byte é uma coluna de 8 pixels, bit 0 em cima. Este script converte cada
+glifo para 4 páginas x 16 colunas (64 bytes), na ordem em que o blit os
+copia, e grava inc/font_big_paginas.c e inc/font_big_paginas.h.
+
+Rodar de novo sempre que a fonte original mudar:
+    python3 tools/gerar_fonte_paginas.py
+"""
+
+import pathlib
+import re
+
+RAIZ = pathlib.Path(__file__).resolve().parent.parent
+ORIGEM = RAIZ / "inc" / "font_big_logo_data.c"
+SAIDA_C = RAIZ / "inc" / "font_big_paginas.c"
+SAIDA_H = RAIZ / "inc" / "font_big_paginas.h"
+
+LARGURA = 16
+ALTURA = 32
+PAGINAS = ALTURA // 8
+
+CABECALHO = """\
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: {arquivo}
+ *  Projeto: TempCycleDMA
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      GERADO por tools/gerar_fonte_paginas.py a partir de
+ *      font_big_logo_data.c — não editar à mão.
+ *
+ *      Glifos 16x32 em páginas do SSD1306: byte [p * 16 + c] é a
+ *      coluna c da página p (bit 0 = linha de cima).
+ * ------------------------------------------------------------
+ */
+"""
+
+
+def ler_glifos(texto):
+    glifos = []
+    padrao = re.compile(r"const\s+uint8_t\s+(\w+)\[64\]\s*=\s*\{([^}]*)\}", re.S)
+    for nome, corpo in padrao.findall(texto):
+        valores = [int(v, 16) for v in re.findall(r"0x[0-9A-Fa-f]{2}", corpo)]
+        if len(valores) != 64:
+            raise SystemExit(f"{nome}: esperado 64 bytes, lidos {len(valores)}")
+        glifos.append((nome, valores))
+    return glifos
+
+
+def para_paginas(linhas):
+    saida = []
+    for p in range(PAGINAS):
+        for c in range(LARGURA):
+            b = 0
+            for k in range(8):
+                linha = p * 8 + k
+                byte = linhas[linha * 2 + c // 8]
+                if (byte >> (7 - c % 8)) & 1:
+                    b |= 1 << k
+            saida.append(b)
+    return saida
+
+
+def main():
+    glifos = ler_glifos(ORIGEM.read_text(encoding="utf-8"))
+
+    # Com TEMPCYCLE_FAST_PATH os glifos ficam na SRAM, junto do blit
+    c = [CABECALHO.format(arquivo=SAIDA_C.name), '#include "font_big_paginas.h"',
+         '#include "caminho_rapido.h"', ""]
+    for nome, linhas in glifos:
+        dados = para_paginas(linhas)
+        c.append(f"const uint8_t {nome}_pag[BIG_GLIFO_BYTES] TABELA_RAPIDA = {{")
+        for p in range(PAGINAS):
+            bloco = dados[p * LARGURA:(p + 1) * LARGURA]
+            c.append("  " + ",".join(f"0x{b:02X}" for b in bloco) + ",")
+        c.append("};")
+        c.append("")
+
+    h = [CABECALHO.format(arquivo=SAIDA_H.name),
+         "#ifndef FONT_BIG_PAGINAS_H",
+         "#define FONT_BIG_PAGINAS_H",
+         "",
+         "#include <stdint.h>",
+         "",
+         f"#define BIG_GLIFO_LARGURA {LARGURA}",
+         f"#define BIG_GLIFO_PAGINAS {PAGINAS}",
+         "#define BIG_GLIFO_BYTES (BIG_GLIFO_LARGURA * BIG_GLIFO_PAGINAS)",
+         ""]
+    for nome, _ in glifos:
+        h.append(f"extern const uint8_t {nome}_pag[BIG_GLIFO_BYTES];")
+    h += ["", "#endif", ""]
+
+    SAIDA_C.write_text("\n".join(c), encoding="utf-8")
+    SAIDA_H.write_text("\n".join(h), encoding="utf-8")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,158 @@
+#!/usr/bin/env python3
+"""
+Decodificador da telemetria binária do TempCycleDMA.
+
+Lê o fluxo do USB CDC (porta serial ou arquivo capturado), procura as
+molduras  A5 5A | n | lote | n x registro(16) | CRC16  e imprime cada
+registro. Bytes fora de moldura (mensagens de texto do firmware) são
+repassados como texto com --texto. Com --udp, recebe os lotes do build
+com Wi-Fi (uma moldura por datagrama).
+
+Uso:
+    python3 tools/telemetria.py /dev/ttyACM0
+    python3 tools/telemetria.py captura.bin --texto
+    python3 tools/telemetria.py --udp 5005
+"""
+
+import argparse
+import struct
+import sys
+
+SYNC = b"\xA5\x5A"
+REGISTRO = struct.Struct("<BBHIiI")
+
+TIPOS = {1: "TEMP", 2: "TEND", 3: "TAREFA", 4: "EVENTO", 5: "ROBUST"}
+TENDENCIAS = {0: "ESTAVEL", 1: "SUBINDO", 2: "CAINDO"}
+EVENTOS = {1: "primeira leitura", 2: "lacuna na rede"}
+
+
+def crc16(dados, crc=0xFFFF):
+    for b in dados:
+        crc ^= b << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+def formatar(tipo, origem, seq, ts, valor, duracao):
+    nome = TIPOS.get(tipo, "tipo%d" % tipo)
+    if tipo == 1:
+        desc = "%.3f C" % (valor / 1000.0)
+    elif tipo == 2:
+        desc = TENDENCIAS.get(valor, str(valor))
+    elif tipo == 3:
+        desc = "atraso %d us, duracao %d us" % (valor, duracao)
+    elif tipo == 4:
+        desc = EVENTOS.get(valor, str(valor))
+        if valor == 2:
+            desc += " (%d ms; medias no historico da flash)" % duracao
+    elif tipo == 5:
+        desc = "mediana %.3f C, desvio %.3f C" % (valor / 1000.0, duracao / 1000.0)
+    else:
+        desc = "valor %d, duracao %d" % (valor, duracao)
+    return "%10.6f s  #%05d  %-6s origem %d  %s" % (ts / 1e6, seq, nome, origem, desc)
+
+
+class Decodificador:
+    def __init__(self, texto=False):
+        self.buf = bytearray()
+        self.texto = texto
+        self.seq_esperada = None
+        self.perdidos = 0
+        self.crc_invalidos = 0
+
+    def alimentar(self, dados):
+        self.buf += dados
+        while True:
+            i = self.buf.find(SYNC)
+            if i < 0:
+                self._texto(self.buf[:-1])
+                del self.buf[:-1]
+                return
+            self._texto(self.buf[:i])
+            del self.buf[:i]
+            if len(self.buf) < 4:
+                return
+            n = self.buf[2]
+            tamanho = 4 + n * REGISTRO.size + 2
+            if len(self.buf) < tamanho:
+                return
+            quadro = bytes(self.buf[:tamanho])
+            crc = struct.unpack_from("<H", quadro, tamanho - 2)[0]
+            if crc16(quadro[2:tamanho - 2]) != crc:
+                self.crc_invalidos += 1
+                del self.buf[:2]   # Sincronismo falso: procura o próximo
+                continue
+            for k in range(n):
+                campos = REGISTRO.unpack_from(quadro, 4 + k * REGISTRO.size)
+                self._registro(campos)
+            del self.buf[:tamanho]
+
+    def _registro(self, campos):
+        seq = campos[2]
+        if self.seq_esperada is not None and seq != self.seq_esperada:
+            self.perdidos += (seq - self.seq_esperada) & 0xFFFF
+        self.seq_esperada = (seq + 1) & 0xFFFF
+        print(formatar(*campos))
+
+    def _texto(self, dados):
+        if self.texto and dados:
+            sys.stdout.write(dados.decode("utf-8", "replace"))
+
+
+def abrir(caminho, baud):
+    if caminho == "-":
+        return sys.stdin.buffer
+    try:
+        import serial  # pyserial
+        return serial.Serial(caminho, baud, timeout=0.2)
+    except (ImportError, ValueError, OSError):
+        return open(caminho, "rb")
+
+
+def receber_udp(dec, porta):
+    import socket
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.bind(("", porta))
+    try:
+        while True:
+            dados, _ = sock.recvfrom(2048)
+            dec.alimentar(dados)
+    except KeyboardInterrupt:
+        pass
+    print("# registros perdidos: %d, molduras com CRC inválido: %d"
+          % (dec.perdidos, dec.crc_invalidos), file=sys.stderr)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[1])
+    ap.add_argument("origem", nargs="?", help="porta serial, arquivo ou '-' para stdin")
+    ap.add_argument("--baud", type=int, default=115200)
+    ap.add_argument("--texto", action="store_true", help="mostrar texto fora das molduras")
+    ap.add_argument("--udp", type=int, metavar="PORTA", help="receber os lotes por UDP")
+    args = ap.parse_args()
+    if args.origem is None and args.udp is None:
+        ap.error("informe a origem ou --udp")
+
+    dec = Decodificador(texto=args.texto)
+    if args.udp is not None:
+        receber_udp(dec, args.udp)
+        return
+    entrada = abrir(args.origem, args.baud)
+    try:
+        while True:
+            dados = entrada.read(256)
+            if not dados:
+                if hasattr(entrada, "in_waiting"):
+                    continue
+                break
+            dec.alimentar(dados)
+    except KeyboardInterrupt:
+        pass
+    print("# registros perdidos: %d, molduras com CRC inválido: %d"
+          % (dec.perdidos, dec.crc_invalidos), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
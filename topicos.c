@@ -0,0 +1,35 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: topicos.c
+ *  Projeto: TempCycleDMA
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Implementação dos tópicos versionados.
+ *
+ *  Relacionamento:
+ *      - Tópicos do encadeamento declarados em 'main.c'
+ *      - Gatilhos das tarefas em 'executor.c'
+ *
+ *
+ *  Data: 14/10/2026
+ * ------------------------------------------------------------
+ */
+
+#include <string.h>
+#include "topicos.h"
+
+void topico_publicar(topico_t *t, const void *registro) {
+    if (registro != t->registro) memcpy(t->registro, registro, t->tamanho);
+    t->versao++;
+}
+
+bool topico_publicar_se_mudou(topico_t *t, const void *registro) {
+    if (t->versao && memcmp(t->registro, registro, t->tamanho) == 0) return false;
+    topico_publicar(t, registro);
+    return true;
+}
+
+uint32_t topico_ler(const topico_t *t, void *destino) {
+    if (t->versao) memcpy(destino, t->registro, t->tamanho);
+    return t->versao;
+}
@@ -0,0 +1,64 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: topicos.h
+ *  Projeto: TempCycleDMA
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Tópicos versionados para o encadeamento das tarefas
+ *      (publicação / assinatura).
+ *
+ *      Um tópico guarda o último registro publicado e um
+ *      contador de versão. Quem publica copia o registro e
+ *      incrementa a versão; quem assina guarda a última
+ *      versão que consumiu e só trabalha quando ela muda.
+ *      No executor, uma tarefa com 'gatilho' só roda nos
+ *      quadros em que o tópico tem versão nova.
+ *
+ *      Todos os tópicos vivem no núcleo 0 (a passagem entre
+ *      núcleos é a fila de 'fila_janelas.c'): sem travas.
+ *
+ *
+ *  Data: 14/10/2026
+ * ------------------------------------------------------------
+ */
+
+#ifndef TOPICOS_H
+#define TOPICOS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef struct {
+    const char *nome;
+    void *registro;             // Último registro publicado (memória do dono)
+    uint16_t tamanho;
+    uint32_t versao;            // Publicações até agora (0 = nada publicado)
+} topico_t;
+
+// Tópico sobre uma variável do dono: TOPICO("amostra", ultima_amostra)
+#define TOPICO(nome_, var_) { (nome_), &(var_), sizeof(var_), 0 }
+
+/**
+ * @brief Copia o registro para o tópico e avança a versão.
+ */
+void topico_publicar(topico_t *t, const void *registro);
+
+/**
+ * @brief Publica só se o registro difere do último (assinantes de mudança).
+ *
+ * @return true se publicou
+ */
+bool topico_publicar_se_mudou(topico_t *t, const void *registro);
+
+/**
+ * @brief Copia o último registro publicado.
+ *
+ * @return versão lida (0 = nada publicado; 'destino' não é alterado)
+ */
+uint32_t topico_ler(const topico_t *t, void *destino);
+
+static inline uint32_t topico_versao(const topico_t *t) {
+    return t->versao;
+}
+
+#endif  // TOPICOS_H